@@ -30,10 +30,11 @@
 
 #include <chrono>
 
+#include "solas/frame_pacer.h"
+
 @interface SLSDisplayLink () {
  @private
-  std::chrono::system_clock::time_point _accumulator;
-  std::chrono::microseconds _interval;
+  solas::FramePacer _pacer;
 }
 
 @property (nonatomic, retain) id target;
@@ -70,14 +71,16 @@
 - (void)setFrameRate:(double)frameRate {
   if (frameRate != _frameRate) {
     _frameRate = frameRate;
-    _interval = std::chrono::microseconds(
-        static_cast<std::chrono::microseconds::rep>(
-            std::chrono::microseconds::period::den / frameRate));
+    _pacer.set_frame_rate(frameRate);
   }
 }
 
+- (NSUInteger)missedFrames {
+  return _pacer.missed();
+}
+
 - (void)start {
-  _accumulator = std::chrono::system_clock::now();
+  _pacer.reset();
   [_link addToRunLoop:[NSRunLoop mainRunLoop]
               forMode:NSRunLoopCommonModes];
 }
@@ -88,22 +91,14 @@
 }
 
 - (void)callback:(CADisplayLink *)sender {
-  if (_interval == std::chrono::microseconds::zero()) {
+  using Clock = solas::FramePacer::Clock;
+  const auto period = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(sender.duration));
+  if (_pacer.tick(Clock::now(), period)) {
     [self.target performSelector:self.selector
                         onThread:[NSThread currentThread]
                       withObject:nil
                    waitUntilDone:YES];
-  } else {
-    const auto elapsed =
-        std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::system_clock::now() - _accumulator);
-    if (elapsed > _interval) {
-      [self.target performSelector:self.selector
-                          onThread:[NSThread currentThread]
-                        withObject:nil
-                     waitUntilDone:YES];
-      _accumulator += _interval * (elapsed / _interval);
-    }
   }
 }
 
@@ -30,10 +30,11 @@
 
 #include <chrono>
 
+#include "solas/frame_pacer.h"
+
 @interface SLSDisplayLink () {
  @private
-  std::chrono::system_clock::time_point _accumulator;
-  std::chrono::microseconds _interval;
+  solas::FramePacer _pacer;
 }
 
 @property (nonatomic, retain) id target;
@@ -83,14 +84,16 @@ static CVReturn DisplayLinkCallback(
 - (void)setFrameRate:(double)frameRate {
   if (frameRate != _frameRate) {
     _frameRate = frameRate;
-    _interval = std::chrono::microseconds(
-        static_cast<std::chrono::microseconds::rep>(
-            std::chrono::microseconds::period::den / frameRate));
+    _pacer.set_frame_rate(frameRate);
   }
 }
 
+- (NSUInteger)missedFrames {
+  return _pacer.missed();
+}
+
 - (void)start {
-  _accumulator = std::chrono::system_clock::now();
+  _pacer.reset();
   CVDisplayLinkStart(_link);
 }
 
@@ -107,22 +110,15 @@ CVReturn DisplayLinkCallback(
     void *userInfo) {
   @autoreleasepool {
     SLSDisplayLink *self = (__bridge SLSDisplayLink *)userInfo;
-    if (self->_interval == std::chrono::microseconds::zero()) {
+    using Clock = solas::FramePacer::Clock;
+    const auto period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(
+            CVDisplayLinkGetActualOutputVideoRefreshPeriod(displayLinkRef)));
+    if (self->_pacer.tick(Clock::now(), period)) {
       [self.target performSelector:self.selector
                           onThread:[NSThread currentThread]
                         withObject:nil
                      waitUntilDone:YES];
-    } else {
-      const auto elapsed =
-          std::chrono::duration_cast<std::chrono::microseconds>(
-              std::chrono::system_clock::now() - self->_accumulator);
-      if (elapsed > self->_interval) {
-        [self.target performSelector:self.selector
-                            onThread:[NSThread currentThread]
-                          withObject:nil
-                       waitUntilDone:YES];
-        self->_accumulator += self->_interval * (elapsed / self->_interval);
-      }
     }
   }
   return kCVReturnSuccess;
@@ -29,6 +29,13 @@
 #include "solas/app_event.h"
 #include "takram/math.h"
 
+@interface SLSCoreGraphicsLayer () {
+ @private
+  solas::AppEvent _event;
+}
+
+@end
+
 @implementation SLSCoreGraphicsLayer
 
 - (instancetype)init {
@@ -43,18 +50,19 @@
 
 - (void)drawInContext:(CGContextRef)context {
   CGRect bounds = self.bounds;
-  const takram::Size2d size(bounds.size.width, bounds.size.height);
+  _event.set_context(context);
+  _event.set_size(takram::Size2d(bounds.size.width, bounds.size.height));
+  _event.set_scale(self.contentsScale);
+  _event.set_alpha(1.0);
   if ([_displayDelegate respondsToSelector:
           @selector(displayDelegate:update:)]) {
-    const solas::AppEvent event(solas::AppEvent::Type::UPDATE,
-                                context, size, self.contentsScale);
-    [_displayDelegate displayDelegate:self update:SLSAppEventMake(&event)];
+    _event.set_type(solas::AppEvent::Type::UPDATE);
+    [_displayDelegate displayDelegate:self update:SLSAppEventMake(&_event)];
   }
   if ([_displayDelegate respondsToSelector:
           @selector(displayDelegate:draw:)]) {
-    const solas::AppEvent event(solas::AppEvent::Type::DRAW,
-                                context, size, self.contentsScale);
-    [_displayDelegate displayDelegate:self draw:SLSAppEventMake(&event)];
+    _event.set_type(solas::AppEvent::Type::DRAW);
+    [_displayDelegate displayDelegate:self draw:SLSAppEventMake(&_event)];
   }
 }
 
@@ -36,6 +36,7 @@
 #pragma mark Controlling the Display Link
 
 @property (nonatomic, assign) double frameRate;
+@property (nonatomic, readonly) NSUInteger missedFrames;
 
 - (void)start;
 - (void)stop;
@@ -46,30 +46,31 @@
 - (void)eventDelegate:(nullable id)eventDelegate
            mouseWheel:(nonnull SLSMouseEventConstRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-           keyPressed:(nonnull SLSKeyEventConstRef)event;
+           keyPressed:(nonnull SLSKeyEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-          keyReleased:(nonnull SLSKeyEventConstRef)event;
+          keyReleased:(nonnull SLSKeyEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-         touchesBegan:(nonnull SLSTouchEventConstRef)event;
+         touchesBegan:(nonnull SLSTouchEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-         touchesMoved:(nonnull SLSTouchEventConstRef)event;
+         touchesMoved:(nonnull SLSTouchEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-     touchesCancelled:(nonnull SLSTouchEventConstRef)event;
+     touchesCancelled:(nonnull SLSTouchEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-         touchesEnded:(nonnull SLSTouchEventConstRef)event;
+         touchesEnded:(nonnull SLSTouchEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-         gestureBegan:(nonnull SLSGestureEventConstRef)event;
+         gestureBegan:(nonnull SLSGestureEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-       gestureChanged:(nonnull SLSGestureEventConstRef)event;
+       gestureChanged:(nonnull SLSGestureEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-     gestureCancelled:(nonnull SLSGestureEventConstRef)event;
+     gestureCancelled:(nonnull SLSGestureEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
-         gestureEnded:(nonnull SLSGestureEventConstRef)event;
+         gestureEnded:(nonnull SLSGestureEventRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
           motionBegan:(nonnull SLSMotionEventConstRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
       motionCancelled:(nonnull SLSMotionEventConstRef)event;
 - (void)eventDelegate:(nullable id)eventDelegate
           motionEnded:(nonnull SLSMotionEventConstRef)event;
+- (BOOL)eventDelegateObservesGestures:(nullable id)eventDelegate;
 
 @end
@@ -30,13 +30,22 @@
 #import "SLSNSViewController.h"
 #import "SLSNSWindowController.h"
 
+#include <memory>
+
 #include "solas/run.h"
+#include "solas/runner.h"
+#include "solas/runner_scheduler.h"
 
 @interface SLSNSApplicationDelegate () {
  @private
   NSMutableArray *_windowControllers;
+  NSUInteger _pendingWindows;
 }
 
+#pragma mark Window Controllers
+
+- (void)showWindowWithRunner:(std::unique_ptr<solas::Runner>&&)runnable;
+
 #pragma mark Window Notifications
 
 - (void)windowWillClose:(NSNotification *)notification;
@@ -62,7 +71,7 @@
 }
 
 - (void)applicationDidBecomeActive:(NSNotification *)notification {
-  if (!_windowControllers.count) {
+  if (!_windowControllers.count && !_pendingWindows) {
     [self newWindow:self];
   }
 }
@@ -79,6 +88,26 @@
   return [NSArray arrayWithArray:_windowControllers];
 }
 
+- (void)showWindowWithRunner:(std::unique_ptr<solas::Runner>&&)runnable {
+  --_pendingWindows;
+  const auto& options = solas::Run::instance().options();
+  SLSRunner *runner = [[SLSRunner alloc]
+      initWithRunnable:std::move(runnable)];
+  SLSNSViewController *viewController =
+      [[SLSNSViewController alloc] initWithRunner:runner];
+  SLSNSWindowController *windowController =
+      [[SLSNSWindowController alloc] initWithViewController:viewController];
+  windowController.darkContent = options.dark_content();
+  windowController.fullSizeContent = options.full_size_content();
+  [[NSNotificationCenter defaultCenter]
+      addObserver:self
+         selector:@selector(windowWillClose:)
+             name:NSWindowWillCloseNotification
+           object:windowController.window];
+  [_windowControllers addObject:windowController];
+  [windowController showWindow:self];
+}
+
 #pragma mark Window Notifications
 
 - (void)windowWillClose:(NSNotification *)notification {
@@ -101,21 +130,20 @@
   if (!options.multiple_windows()) {
     return;
   }
-  SLSRunner *runner = [[SLSRunner alloc]
-      initWithRunnable:solas::Run::instance().create()];
-  SLSNSViewController *viewController =
-      [[SLSNSViewController alloc] initWithRunner:runner];
-  SLSNSWindowController *windowController =
-      [[SLSNSWindowController alloc] initWithViewController:viewController];
-  windowController.darkContent = options.dark_content();
-  windowController.fullSizeContent = options.full_size_content();
-  [[NSNotificationCenter defaultCenter]
-      addObserver:self
-         selector:@selector(windowWillClose:)
-             name:NSWindowWillCloseNotification
-           object:windowController.window];
-  [_windowControllers addObject:windowController];
-  [windowController showWindow:self];
+  // Create the runner on the shared scheduler so that the setup of several
+  // windows doesn't serialize on the main thread.
+  ++_pendingWindows;
+  __weak SLSNSApplicationDelegate *weakSelf = self;
+  solas::RunnerScheduler::shared().dispatch([weakSelf] {
+    solas::Runner *runner = solas::Run::instance().create().release();
+    dispatch_async(dispatch_get_main_queue(), ^{
+      std::unique_ptr<solas::Runner> owner(runner);
+      SLSNSApplicationDelegate *strongSelf = weakSelf;
+      if (strongSelf) {
+        [strongSelf showWindowWithRunner:std::move(owner)];
+      }
+    });
+  });
 }
 
 #pragma mark NSUserInterfaceValidations
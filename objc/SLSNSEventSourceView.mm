@@ -29,12 +29,14 @@
 #import "SLSEvents.h"
 
 #include <string>
+#include <utility>
 
 #include "solas/gesture_event.h"
 #include "solas/key_event.h"
 #include "solas/key_modifier.h"
 #include "solas/mouse_button.h"
 #include "solas/mouse_event.h"
+#include "solas/payload_pool.h"
 #include "solas/touch_event.h"
 #include "takram/math.h"
 
@@ -220,10 +222,12 @@
 
 - (solas::KeyEvent)keyEventWithEvent:(NSEvent *)event
     type:(solas::KeyEvent::Type)type {
+  auto characters = solas::PayloadPool::shared().characters();
+  characters.assign(event.characters.UTF8String);
   return solas::KeyEvent(
       type,
       event.keyCode,
-      std::string(event.characters.UTF8String),
+      std::move(characters),
       [self keyModifiersForEvent:event]);
 }
 
@@ -331,7 +335,7 @@
 - (void)notifyKeyPressedWithEvent:(id)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:keyPressed:)]) {
-    const auto keyEvent([self keyEventWithEvent:event
+    auto keyEvent([self keyEventWithEvent:event
         type:solas::KeyEvent::Type::PRESSED]);
     [_eventDelegate eventDelegate:self
                        keyPressed:SLSKeyEventMake(&keyEvent)];
@@ -341,7 +345,7 @@
 - (void)notifyKeyReleasedWithEvent:(id)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:keyReleased:)]) {
-    const auto keyEvent([self keyEventWithEvent:event
+    auto keyEvent([self keyEventWithEvent:event
         type:solas::KeyEvent::Type::RELEASED]);
     [_eventDelegate eventDelegate:self
                       keyReleased:SLSKeyEventMake(&keyEvent)];
@@ -351,7 +355,7 @@
 - (void)notifyTouchesBeganWithEvent:(id)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:touchesBegan:)]) {
-    const auto touchEvent([self touchEventWithEvent:event
+    auto touchEvent([self touchEventWithEvent:event
         type:solas::TouchEvent::Type::BEGAN]);
     [_eventDelegate eventDelegate:self
                      touchesBegan:SLSTouchEventMake(&touchEvent)];
@@ -361,7 +365,7 @@
 - (void)notifyTouchesMovedWithEvent:(id)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:touchesMoved:)]) {
-    const auto touchEvent([self touchEventWithEvent:event
+    auto touchEvent([self touchEventWithEvent:event
         type:solas::TouchEvent::Type::MOVED]);
     [_eventDelegate eventDelegate:self
                      touchesMoved:SLSTouchEventMake(&touchEvent)];
@@ -371,7 +375,7 @@
 - (void)notifyTouchesCancelledWithEvent:(id)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:touchesCancelled:)]) {
-    const auto touchEvent([self touchEventWithEvent:event
+    auto touchEvent([self touchEventWithEvent:event
         type:solas::TouchEvent::Type::CANCELLED]);
     [_eventDelegate eventDelegate:self
                  touchesCancelled:SLSTouchEventMake(&touchEvent)];
@@ -381,7 +385,7 @@
 - (void)notifyTouchesEndedWithEvent:(id)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:touchesEnded:)]) {
-    const auto touchEvent([self touchEventWithEvent:event
+    auto touchEvent([self touchEventWithEvent:event
         type:solas::TouchEvent::Type::ENDED]);
     [_eventDelegate eventDelegate:self
                      touchesEnded:SLSTouchEventMake(&touchEvent)];
@@ -37,6 +37,7 @@
 @interface SLSNSOpenGLLayer () {
  @private
   solas::Framebuffer _framebuffer;
+  solas::AppEvent _event;
 }
 
 @property (nonatomic, assign) NSOpenGLPixelFormatAttribute API;
@@ -86,12 +87,14 @@
                   forLayerTime:(CFTimeInterval)layerTime
                    displayTime:(const CVTimeStamp *)displayTime {
   const CGRect bounds = self.bounds;
-  const takram::Size2d size(bounds.size.width, bounds.size.height);
-  const solas::AppEvent event(solas::AppEvent::Type::UPDATE,
-                              context, size, self.contentsScale);
   if ([_displayDelegate respondsToSelector:
           @selector(displayDelegate:update:)]) {
-    [_displayDelegate displayDelegate:self update:SLSAppEventMake(&event)];
+    _event.set_type(solas::AppEvent::Type::UPDATE);
+    _event.set_context(context);
+    _event.set_size(takram::Size2d(bounds.size.width, bounds.size.height));
+    _event.set_scale(self.contentsScale);
+    _event.set_alpha(1.0);
+    [_displayDelegate displayDelegate:self update:SLSAppEventMake(&_event)];
   }
   return YES;
 }
@@ -108,11 +111,13 @@
   _framebuffer.bind();
   glClearColor(1.0, 1.0, 1.0, 1.0);
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-  const takram::Size2d size(bounds.size.width, bounds.size.height);
-  const solas::AppEvent event(solas::AppEvent::Type::DRAW,
-                              context, size, scale);
   if ([_displayDelegate respondsToSelector:@selector(displayDelegate:draw:)]) {
-    [_displayDelegate displayDelegate:self draw:SLSAppEventMake(&event)];
+    _event.set_type(solas::AppEvent::Type::DRAW);
+    _event.set_context(context);
+    _event.set_size(takram::Size2d(bounds.size.width, bounds.size.height));
+    _event.set_scale(scale);
+    _event.set_alpha(1.0);
+    [_displayDelegate displayDelegate:self draw:SLSAppEventMake(&_event)];
   }
   _framebuffer.transfer(framebuffer);
   glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
@@ -231,82 +231,82 @@ inline void RunnerDelegate::fullScreen(bool flag) {
 }
 
 - (void)eventDelegate:(id)eventDelegate
-           keyPressed:(SLSKeyEventConstRef)event {
+           keyPressed:(SLSKeyEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->keyPressed(*SLSKeyEventCast(event));
+    _runner->keyPressed(std::move(*SLSKeyEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-          keyReleased:(SLSKeyEventConstRef)event {
+          keyReleased:(SLSKeyEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->keyReleased(*SLSKeyEventCast(event));
+    _runner->keyReleased(std::move(*SLSKeyEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-         touchesBegan:(SLSTouchEventConstRef)event {
+         touchesBegan:(SLSTouchEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->touchesBegan(*SLSTouchEventCast(event));
+    _runner->touchesBegan(std::move(*SLSTouchEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-         touchesMoved:(SLSTouchEventConstRef)event {
+         touchesMoved:(SLSTouchEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->touchesMoved(*SLSTouchEventCast(event));
+    _runner->touchesMoved(std::move(*SLSTouchEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-     touchesCancelled:(SLSTouchEventConstRef)event {
+     touchesCancelled:(SLSTouchEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->touchesCancelled(*SLSTouchEventCast(event));
+    _runner->touchesCancelled(std::move(*SLSTouchEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-         touchesEnded:(SLSTouchEventConstRef)event {
+         touchesEnded:(SLSTouchEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->touchesEnded(*SLSTouchEventCast(event));
+    _runner->touchesEnded(std::move(*SLSTouchEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-         gestureBegan:(SLSGestureEventConstRef)event {
+         gestureBegan:(SLSGestureEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->gestureBegan(*SLSGestureEventCast(event));
+    _runner->gestureBegan(std::move(*SLSGestureEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-       gestureChanged:(SLSGestureEventConstRef)event {
+       gestureChanged:(SLSGestureEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->gestureChanged(*SLSGestureEventCast(event));
+    _runner->gestureChanged(std::move(*SLSGestureEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-     gestureCancelled:(SLSGestureEventConstRef)event {
+     gestureCancelled:(SLSGestureEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->gestureCancelled(*SLSGestureEventCast(event));
+    _runner->gestureCancelled(std::move(*SLSGestureEventCast(event)));
   }
 }
 
 - (void)eventDelegate:(id)eventDelegate
-         gestureEnded:(SLSGestureEventConstRef)event {
+         gestureEnded:(SLSGestureEventRef)event {
   if (_runner) {
     NSAssert(event, @"");
-    _runner->gestureEnded(*SLSGestureEventCast(event));
+    _runner->gestureEnded(std::move(*SLSGestureEventCast(event)));
   }
 }
 
@@ -334,4 +334,15 @@ inline void RunnerDelegate::fullScreen(bool flag) {
   }
 }
 
+- (BOOL)eventDelegateObservesGestures:(id)eventDelegate {
+  if (!_runner) {
+    return NO;
+  }
+  using Type = solas::GestureEvent::Type;
+  return (_runner->observes(Type::BEGAN) ||
+          _runner->observes(Type::CHANGED) ||
+          _runner->observes(Type::CANCELLED) ||
+          _runner->observes(Type::ENDED));
+}
+
 @end
@@ -28,6 +28,8 @@
 
 #import "SLSEvents.h"
 
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 #include <boost/any.hpp>
@@ -35,6 +37,7 @@
 #include "solas/gesture_event.h"
 #include "solas/gesture_kind.h"
 #include "solas/motion_event.h"
+#include "solas/payload_pool.h"
 #include "solas/touch_event.h"
 #include "takram/math.h"
 
@@ -128,12 +131,34 @@
 
 - (solas::TouchEvent)touchEventWithEvent:(UIEvent *)event
     type:(solas::TouchEvent::Type)type {
-  std::vector<takram::Vec2d> touches;
+  auto& pool = solas::PayloadPool::shared();
+  auto touches = pool.touches();
+  auto contacts = pool.contacts();
   for (UITouch *touch in event.allTouches) {
     CGPoint location = [touch locationInView:self];
     touches.emplace_back(location.x, location.y);
+
+    // UIKit keeps the same touch object while the touch is down
+    solas::TouchEvent::Contact contact;
+    contact.identifier = reinterpret_cast<std::uintptr_t>(
+        (__bridge void *)touch);
+    switch (touch.phase) {
+      case UITouchPhaseBegan:
+        contact.phase = solas::TouchEvent::Type::BEGAN;
+        break;
+      case UITouchPhaseEnded:
+        contact.phase = solas::TouchEvent::Type::ENDED;
+        break;
+      case UITouchPhaseCancelled:
+        contact.phase = solas::TouchEvent::Type::CANCELLED;
+        break;
+      default:
+        contact.phase = solas::TouchEvent::Type::MOVED;
+        break;
+    }
+    contacts.emplace_back(contact);
   }
-  return solas::TouchEvent(type, touches);
+  return solas::TouchEvent(type, std::move(touches), std::move(contacts));
 }
 
 - (solas::MotionEvent)motionEventWithEvent:(UIEvent *)event
@@ -147,12 +172,12 @@
     type:(solas::GestureEvent::Type)type
     kind:(solas::GestureKind)kind
     data:(const boost::any&)data {
-  std::vector<takram::Vec2d> touches;
+  auto touches = solas::PayloadPool::shared().touches();
   for (NSInteger i = 0; i < recognizer.numberOfTouches; ++i) {
     CGPoint location = [recognizer locationOfTouch:i inView:self];
     touches.emplace_back(location.x, location.y);
   }
-  return solas::GestureEvent(type, kind, touches, data);
+  return solas::GestureEvent(type, kind, std::move(touches), data);
 }
 
 #pragma mark Notifying Events to the Delegate
@@ -160,7 +185,7 @@
 - (void)notifyTouchesBeganWithEvent:(UIEvent *)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:touchesBegan:)]) {
-    const auto touchEvent([self touchEventWithEvent:event
+    auto touchEvent([self touchEventWithEvent:event
         type:solas::TouchEvent::Type::BEGAN]);
     [_eventDelegate eventDelegate:self
                      touchesBegan:SLSTouchEventMake(&touchEvent)];
@@ -170,7 +195,7 @@
 - (void)notifyTouchesMovedWithEvent:(UIEvent *)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:touchesMoved:)]) {
-    const auto touchEvent([self touchEventWithEvent:event
+    auto touchEvent([self touchEventWithEvent:event
         type:solas::TouchEvent::Type::MOVED]);
     [_eventDelegate eventDelegate:self
                      touchesMoved:SLSTouchEventMake(&touchEvent)];
@@ -180,7 +205,7 @@
 - (void)notifyTouchesCancelledWithEvent:(UIEvent *)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:touchesCancelled:)]) {
-    const auto touchEvent([self touchEventWithEvent:event
+    auto touchEvent([self touchEventWithEvent:event
         type:solas::TouchEvent::Type::CANCELLED]);
     [_eventDelegate eventDelegate:self
                  touchesCancelled:SLSTouchEventMake(&touchEvent)];
@@ -190,7 +215,7 @@
 - (void)notifyTouchesEndedWithEvent:(UIEvent *)event {
   if ([_eventDelegate respondsToSelector:
           @selector(eventDelegate:touchesEnded:)]) {
-    const auto touchEvent([self touchEventWithEvent:event
+    auto touchEvent([self touchEventWithEvent:event
         type:solas::TouchEvent::Type::ENDED]);
     [_eventDelegate eventDelegate:self
                      touchesEnded:SLSTouchEventMake(&touchEvent)];
@@ -263,10 +288,16 @@
 - (void)notifyGestureWithRecognizer:(UIGestureRecognizer *)recognizer
                                kind:(solas::GestureKind)kind
                                data:(const boost::any&)data {
+  // Skip collecting the touches of the recognizer when nothing observes
+  if ([_eventDelegate respondsToSelector:
+          @selector(eventDelegateObservesGestures:)] &&
+      ![_eventDelegate eventDelegateObservesGestures:self]) {
+    return;
+  }
   if (recognizer.state == UIGestureRecognizerStateBegan) {
     if ([_eventDelegate respondsToSelector:
             @selector(eventDelegate:gestureBegan:)]) {
-      const auto event([self gestureEventWithRecognizer:recognizer
+      auto event([self gestureEventWithRecognizer:recognizer
           type:solas::GestureEvent::Type::BEGAN
           kind:kind data:data]);
       [_eventDelegate eventDelegate:self
@@ -275,7 +306,7 @@
   } else if (recognizer.state == UIGestureRecognizerStateChanged) {
     if ([_eventDelegate respondsToSelector:
             @selector(eventDelegate:gestureChanged:)]) {
-      const auto event([self gestureEventWithRecognizer:recognizer
+      auto event([self gestureEventWithRecognizer:recognizer
           type:solas::GestureEvent::Type::CHANGED
           kind:kind data:data]);
       [_eventDelegate eventDelegate:self
@@ -284,7 +315,7 @@
   } else if (recognizer.state == UIGestureRecognizerStateCancelled) {
     if ([_eventDelegate respondsToSelector:
             @selector(eventDelegate:gestureCancelled:)]) {
-      const auto event([self gestureEventWithRecognizer:recognizer
+      auto event([self gestureEventWithRecognizer:recognizer
           type:solas::GestureEvent::Type::CANCELLED
           kind:kind data:data]);
       [_eventDelegate eventDelegate:self
@@ -293,7 +324,7 @@
   } else if (recognizer.state == UIGestureRecognizerStateEnded) {
     if ([_eventDelegate respondsToSelector:
             @selector(eventDelegate:gestureEnded:)]) {
-      const auto event([self gestureEventWithRecognizer:recognizer
+      auto event([self gestureEventWithRecognizer:recognizer
           type:solas::GestureEvent::Type::ENDED
           kind:kind data:data]);
       [_eventDelegate eventDelegate:self
@@ -31,7 +31,10 @@
 #include "solas/app_event.h"
 #include "takram/math.h"
 
-@interface SLSUIOpenGLESView () <GLKViewDelegate>
+@interface SLSUIOpenGLESView () <GLKViewDelegate> {
+ @private
+  solas::AppEvent _event;
+}
 
 #pragma mark Initialization
 
@@ -91,13 +94,18 @@
                             withObject:nil
                          waitUntilDone:NO];
   }
+  // Hold the context in a local so that the event refers to a live object
+  // for the duration of the delegate call.
+  EAGLContext *context = _view.context;
   CGRect bounds = self.bounds;
-  const takram::Size2d size(bounds.size.width, bounds.size.height);
-  const solas::AppEvent event(solas::AppEvent::Type::UPDATE,
-                              _view.context, size, [UIScreen mainScreen].scale);
   if ([_displayDelegate respondsToSelector:
           @selector(displayDelegate:update:)]) {
-    [_displayDelegate displayDelegate:self update:SLSAppEventMake(&event)];
+    _event.set_type(solas::AppEvent::Type::UPDATE);
+    _event.set_context(context);
+    _event.set_size(takram::Size2d(bounds.size.width, bounds.size.height));
+    _event.set_scale([UIScreen mainScreen].scale);
+    _event.set_alpha(1.0);
+    [_displayDelegate displayDelegate:self update:SLSAppEventMake(&_event)];
   }
   [_view setNeedsDisplay];
 }
@@ -107,12 +115,15 @@
 - (void)glkView:(GLKView *)view drawInRect:(CGRect)rect {
   glClearColor(1.0, 1.0, 1.0, 1.0);
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+  EAGLContext *context = _view.context;
   CGRect bounds = self.bounds;
-  const takram::Size2d size(bounds.size.width, bounds.size.height);
-  const solas::AppEvent event(solas::AppEvent::Type::DRAW,
-                              _view.context, size, [UIScreen mainScreen].scale);
   if ([_displayDelegate respondsToSelector:@selector(displayDelegate:draw:)]) {
-    [_displayDelegate displayDelegate:self draw:SLSAppEventMake(&event)];
+    _event.set_type(solas::AppEvent::Type::DRAW);
+    _event.set_context(context);
+    _event.set_size(takram::Size2d(bounds.size.width, bounds.size.height));
+    _event.set_scale([UIScreen mainScreen].scale);
+    _event.set_alpha(1.0);
+    [_displayDelegate displayDelegate:self draw:SLSAppEventMake(&_event)];
   }
 }
 
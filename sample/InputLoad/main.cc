@@ -0,0 +1,98 @@
+//
+//  main.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "solas.h"
+
+// Counts the allocations of the whole process, so that the report includes
+// those of the event path
+SOLAS_COUNT_ALLOCATIONS();
+
+class App : public solas::View {
+ public:
+  void draw() override {}
+  void mouseMoved() override {}
+  void mouseDragged() override {}
+  void keyPressed() override {}
+  void touchesMoved() override {}
+  void gestureChanged() override {}
+};
+
+void measure(const char *name,
+             const solas::InputLoadOptions& options,
+             const solas::RunnerOptions& runner_options,
+             std::size_t frames) {
+  solas::Runner runner(std::make_unique<App>(), runner_options);
+  solas::InputLoadGenerator generator(options);
+
+  // Exclude the setup and the first allocations of the pools
+  generator.run(runner, 60);
+  const auto& report = generator.run(runner, frames);
+  std::printf("%-22s %7.2f %9.0f %9.1f %9.1f %9.1f %11.2f\n",
+              name,
+              report.events_per_second() / 1.0e+6,
+              static_cast<double>(report.events) / report.frames,
+              report.dispatch.percentile(50.0) * 1.0e+6,
+              report.drain.percentile(50.0) * 1.0e+6,
+              report.drain.percentile(99.0) * 1.0e+6,
+              report.allocations_per_frame());
+}
+
+int main(int argc, char **argv) {
+  using solas::InputLoadOptions;
+  const std::size_t frames = (argc > 1 ? std::atoi(argv[1]) : 3000);
+  solas::RunnerOptions options;
+  solas::RunnerOptions coalescing;
+  coalescing.set_coalesces_events(true);
+  solas::RunnerOptions recognizing;
+  recognizing.set_recognizes_gestures(true);
+
+  // Dispatch and drain times are the medians and 99th percentiles per frame
+  // in microseconds
+  std::printf("%-22s %7s %9s %9s %9s %9s %11s\n",
+              "scenario", "Mev/s", "ev/frame", "dispatch", "drain",
+              "drain p99", "alloc/frame");
+  measure("mouse 1k/s", InputLoadOptions::mousePath(), options, frames);
+  measure("mouse 60k/s", InputLoadOptions::mousePath(60000.0),
+          options, frames);
+  measure("mouse 60k/s coalesced", InputLoadOptions::mousePath(60000.0),
+          coalescing, frames);
+  measure("touch 240/s x10", InputLoadOptions::touchSwarm(),
+          options, frames);
+  measure("touch 2400/s x40", InputLoadOptions::touchSwarm(2400.0, 40),
+          options, frames);
+  measure("keys 200/s", InputLoadOptions::keyBursts(), options, frames);
+  measure("gestures 120/s", InputLoadOptions::gestureSequences(),
+          options, frames);
+  measure("mixed", InputLoadOptions::mixed(), options, frames);
+  measure("mixed recognized", InputLoadOptions::mixed(), recognizing,
+          frames);
+  return EXIT_SUCCESS;
+}
@@ -36,29 +36,72 @@ extern const unsigned char version_string[];
 
 }  // namespace solas
 
+#include "solas/allocation_counter.h"
 #include "solas/app_event.h"
 #include "solas/backend.h"
 #include "solas/composite.h"
+#include "solas/event_batch.h"
+#include "solas/event_drain.h"
 #include "solas/event_holder.h"
+#include "solas/event_hook.h"
+#include "solas/event_latency.h"
+#include "solas/event_log.h"
+#include "solas/event_mask.h"
+#include "solas/event_overflow.h"
+#include "solas/event_queue.h"
+#include "solas/event_recorder.h"
+#include "solas/event_replayer.h"
+#include "solas/event_signal.h"
+#include "solas/frame_pacer.h"
+#include "solas/frame_state.h"
+#include "solas/frame_state_ring.h"
+#include "solas/frame_worker.h"
 #include "solas/gesture_event.h"
 #include "solas/gesture_kind.h"
+#include "solas/gesture_recognizer.h"
 #include "solas/group.h"
+#include "solas/headless_context.h"
+#include "solas/headless_run_loop.h"
+#include "solas/input_resampler.h"
+#include "solas/input_load_generator.h"
+#include "solas/input_load_options.h"
+#include "solas/input_source.h"
 #include "solas/key_event.h"
 #include "solas/key_modifier.h"
+#include "solas/latency_histogram.h"
+#include "solas/latency_stage.h"
+#include "solas/mapped_file.h"
 #include "solas/motion_event.h"
+#include "solas/motion_file_source.h"
+#include "solas/motion_filter.h"
 #include "solas/motion_kind.h"
+#include "solas/motion_ring.h"
+#include "solas/motion_sample.h"
+#include "solas/motion_window.h"
 #include "solas/mouse_button.h"
 #include "solas/mouse_event.h"
+#include "solas/payload_pool.h"
+#include "solas/pending_input.h"
 #include "solas/run.h"
 #include "solas/run_options.h"
 #include "solas/runnable.h"
 #include "solas/runner.h"
 #include "solas/runner_options.h"
 #include "solas/runner_delegate.h"
+#include "solas/runner_scheduler.h"
 #include "solas/screen_edge.h"
+#include "solas/shared_input.h"
+#include "solas/shared_input_codec.h"
+#include "solas/shared_input_source.h"
+#include "solas/shared_input_writer.h"
+#include "solas/shared_memory.h"
+#include "solas/span.h"
+#include "solas/static_view.h"
 #include "solas/swipe_direction.h"
 #include "solas/touch_event.h"
+#include "solas/touch_tracker.h"
 #include "solas/view.h"
+#include "solas/view_state.h"
 
 #endif  // __cplusplus
 
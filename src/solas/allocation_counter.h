@@ -0,0 +1,105 @@
+//
+//  solas/allocation_counter.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_ALLOCATION_COUNTER_H_
+#define SOLAS_ALLOCATION_COUNTER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace solas {
+
+// Counts calls to the global operator new of the process. Counting is only in
+// effect in an executable that replaces the operators by placing
+// SOLAS_COUNT_ALLOCATIONS() at namespace scope in one of its sources, so that
+// the library itself never changes how an application allocates memory.
+class AllocationCounter final {
+ public:
+  AllocationCounter() = delete;
+
+  // Counting
+  static bool installed() { return installed_flag(); }
+  static std::size_t count();
+  static void install() { installed_flag() = true; }
+  static void increment();
+
+ private:
+  static std::atomic<std::size_t>& counter();
+  static bool& installed_flag();
+};
+
+#pragma mark -
+
+inline std::size_t AllocationCounter::count() {
+  return counter().load(std::memory_order_relaxed);
+}
+
+inline void AllocationCounter::increment() {
+  counter().fetch_add(1, std::memory_order_relaxed);
+}
+
+inline std::atomic<std::size_t>& AllocationCounter::counter() {
+  static std::atomic<std::size_t> counter(0);
+  return counter;
+}
+
+inline bool& AllocationCounter::installed_flag() {
+  static bool installed = false;
+  return installed;
+}
+
+}  // namespace solas
+
+#define SOLAS_COUNT_ALLOCATIONS() \
+  void * operator new(std::size_t size) { \
+    solas::AllocationCounter::increment(); \
+    if (void *pointer = std::malloc(size ? size : 1)) { \
+      return pointer; \
+    } \
+    throw std::bad_alloc(); \
+  } \
+  void * operator new[](std::size_t size) { \
+    return operator new(size); \
+  } \
+  void operator delete(void *pointer) noexcept { \
+    std::free(pointer); \
+  } \
+  void operator delete[](void *pointer) noexcept { \
+    std::free(pointer); \
+  } \
+  void operator delete(void *pointer, std::size_t) noexcept { \
+    std::free(pointer); \
+  } \
+  void operator delete[](void *pointer, std::size_t) noexcept { \
+    std::free(pointer); \
+  } \
+  static const bool solas_allocation_counter_installed = \
+      (solas::AllocationCounter::install(), true)
+
+#endif  // SOLAS_ALLOCATION_COUNTER_H_
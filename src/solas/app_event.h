@@ -28,7 +28,7 @@
 #ifndef SOLAS_APP_EVENT_H_
 #define SOLAS_APP_EVENT_H_
 
-#include <functional>
+#include <typeinfo>
 
 #include <boost/any.hpp>
 
@@ -48,6 +48,7 @@ class AppEvent final {
   };
 
  public:
+  AppEvent() : AppEvent(Type::SETUP) {}
   explicit AppEvent(Type type);
   template <class Context>
   AppEvent(Type type,
@@ -55,27 +56,45 @@ class AppEvent final {
            const takram::Size2d& size,
            double scale);
 
-  // Copy semantics excluding assignment
+  // Copy semantics
   AppEvent(const AppEvent&) = default;
-  AppEvent& operator=(const AppEvent&) = delete;
+  AppEvent& operator=(const AppEvent&) = default;
 
   // Properties
   Type type() const { return type_; }
+  void set_type(Type value) { type_ = value; }
   template <class Context>
   const Context& context() const;
+  template <class Context>
+  void set_context(const Context& value);
+  bool has_context() const { return context_; }
   const takram::Size2d& size() const { return size_; }
+  void set_size(const takram::Size2d& value) { size_ = value; }
   double scale() const { return scale_; }
+  void set_scale(double value) { scale_ = value; }
+  double alpha() const { return alpha_; }
+  void set_alpha(double value) { alpha_ = value; }
 
  private:
   Type type_;
-  boost::any context_;
+  const void *context_;
+  // The type of the context is compared by its type info rather than by the
+  // address of a per-type static, which differs between the framework and
+  // the application when inline functions are hidden.
+  const std::type_info *context_type_;
   takram::Size2d size_;
   double scale_;
+  double alpha_;
 };
 
 #pragma mark -
 
-inline AppEvent::AppEvent(Type type) : type_(type) {}
+inline AppEvent::AppEvent(Type type)
+    : type_(type),
+      context_(),
+      context_type_(),
+      scale_(),
+      alpha_(1.0) {}
 
 template <class Context>
 inline AppEvent::AppEvent(Type type,
@@ -83,15 +102,26 @@ inline AppEvent::AppEvent(Type type,
                           const takram::Size2d& size,
                           double scale)
     : type_(type),
-      context_(std::reference_wrapper<const Context>(context)),
+      context_(&context),
+      context_type_(&typeid(Context)),
       size_(size),
-      scale_(scale) {}
+      scale_(scale),
+      alpha_(1.0) {}
 
 #pragma mark Properties
 
 template <class Context>
 inline const Context& AppEvent::context() const {
-  return boost::any_cast<std::reference_wrapper<const Context>>(context_);
+  if (!context_ || *context_type_ != typeid(Context)) {
+    throw boost::bad_any_cast();
+  }
+  return *static_cast<const Context *>(context_);
+}
+
+template <class Context>
+inline void AppEvent::set_context(const Context& value) {
+  context_ = &value;
+  context_type_ = &typeid(Context);
 }
 
 }  // namespace solas
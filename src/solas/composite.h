@@ -34,6 +34,7 @@
 #include <utility>
 
 #include "solas/mouse_button.h"
+#include "solas/view_state.h"
 #include "takram/math.h"
 
 namespace solas {
@@ -58,56 +59,91 @@ class Composite {
   virtual void fullScreen(bool flag) const;
 
   // Structure
-  virtual const takram::Size2d& size() const;
-  virtual double width() const;
-  virtual double height() const;
-  virtual double scale() const;
+  const takram::Size2d& size() const;
+  double width() const;
+  double height() const;
+  double scale() const;
 
   // Mouse
-  virtual const takram::Vec2d& mouse() const;
-  virtual const takram::Vec2d& pmouse() const;
-  virtual MouseButton mouse_button() const;
-  virtual bool mouse_pressed() const;
+  const takram::Vec2d& mouse() const;
+  const takram::Vec2d& pmouse() const;
+  MouseButton mouse_button() const;
+  bool mouse_pressed() const;
+  const takram::Vec2d& predicted_mouse() const;
+  const takram::Vec2d& mouse_velocity() const;
 
   // Key
-  virtual char key() const;
-  virtual std::uint32_t key_code() const;
-  virtual bool key_pressed() const;
+  char key() const;
+  std::uint32_t key_code() const;
+  bool key_pressed() const;
 
   // Touches
-  virtual const takram::Vec2d& touch() const;
-  virtual const takram::Vec2d& ptouch() const;
-  virtual bool touch_pressed() const;
+  const takram::Vec2d& touch() const;
+  const takram::Vec2d& ptouch() const;
+  bool touch_pressed() const;
+  const takram::Vec2d& predicted_touch() const;
+  const takram::Vec2d& touch_velocity() const;
 
   // Aggregation
   virtual Composite * parent() const;
+  Composite * root() const;
 
  protected:
   Composite();
 
+  // The root of a tree gives the state, and the others share it
+  const ViewState& state() const;
+  void set_state(ViewState *value);
+
+ private:
+  static ViewState * stateOf(Composite *parent);
+
  private:
   Composite *parent_;
+
+  // Cached when constructed, so that reading the state or finding the root
+  // doesn't walk up the tree. The state lives outside of the root and points
+  // back to it, so that moving the root only has to update that pointer.
+  ViewState *state_;
 };
 
 #pragma mark -
 
-inline Composite::Composite() : parent_(nullptr) {}
+inline Composite::Composite()
+    : parent_(nullptr),
+      state_(nullptr) {}
 
-inline Composite::Composite(Composite *parent) : parent_(parent) {
-  assert(parent);
-}
+inline Composite::Composite(Composite *parent)
+    : parent_(parent),
+      state_(stateOf(parent)) {}
 
 inline Composite::~Composite() {}
 
 #pragma mark Move semantics
 
-inline Composite::Composite(Composite&& other) : parent_(other.parent_) {
+inline Composite::Composite(Composite&& other)
+    : parent_(other.parent_),
+      state_(other.state_) {
+  if (state_ && state_->root == &other) {
+    state_->root = this;
+  }
   other.parent_ = nullptr;
+  other.state_ = nullptr;
 }
 
 inline Composite& Composite::operator=(Composite&& other) {
   if (&other != this) {
     std::swap(parent_, other.parent_);
+    if (state_ && state_->root == this) {
+      // The root owns its state, which goes away with what it is replaced by
+      state_ = other.state_;
+      other.state_ = nullptr;
+    } else {
+      std::swap(state_, other.state_);
+    }
+    if (state_ && state_->root == &other) {
+      state_->root = this;
+    }
   }
   return *this;
 }
@@ -115,101 +151,121 @@ inline Composite& Composite::operator=(Composite&& other) {
 #pragma mark Environment
 
 inline void Composite::frameRate(double fps) const {
-  assert(parent_);
-  return parent_->frameRate(fps);
+  assert(root() != this);
+  return root()->frameRate(fps);
 }
 
 inline void Composite::resize(const takram::Size2d& size) const {
-  assert(parent_);
-  return parent_->resize(size);
+  assert(root() != this);
+  return root()->resize(size);
 }
 
 inline void Composite::resize(double width, double height) const {
-  assert(parent_);
-  return parent_->resize(width, height);
+  assert(root() != this);
+  return root()->resize(width, height);
 }
 
 inline void Composite::fullScreen(bool flag) const {
-  assert(parent_);
-  return parent_->fullScreen(flag);
+  assert(root() != this);
+  return root()->fullScreen(flag);
+}
+
+#pragma mark State
+
+inline const ViewState& Composite::state() const {
+  assert(state_);
+  return *state_;
+}
+
+inline void Composite::set_state(ViewState *value) {
+  assert(value);
+  state_ = value;
+  state_->root = this;
+}
+
+inline ViewState * Composite::stateOf(Composite *parent) {
+  assert(parent);
+  return parent->state_;
 }
 
 #pragma mark Structure
 
 inline const takram::Size2d& Composite::size() const {
-  assert(parent_);
-  return parent_->size();
+  return state().size;
 }
 
 inline double Composite::width() const {
-  assert(parent_);
-  return parent_->width();
+  return state().size.width;
 }
 
 inline double Composite::height() const {
-  assert(parent_);
-  return parent_->height();
+  return state().size.height;
 }
 
 inline double Composite::scale() const {
-  assert(parent_);
-  return parent_->scale();
+  return state().scale;
 }
 
 #pragma mark Mouse
 
 inline const takram::Vec2d& Composite::mouse() const {
-  assert(parent_);
-  return parent_->mouse();
+  return state().mouse;
 }
 
 inline const takram::Vec2d& Composite::pmouse() const {
-  assert(parent_);
-  return parent_->pmouse();
+  return state().pmouse;
 }
 
 inline MouseButton Composite::mouse_button() const {
-  assert(parent_);
-  return parent_->mouse_button();
+  return state().mouse_button;
 }
 
 inline bool Composite::mouse_pressed() const {
-  assert(parent_);
-  return parent_->mouse_pressed();
+  return state().mouse_pressed;
+}
+
+inline const takram::Vec2d& Composite::predicted_mouse() const {
+  return state().predicted_mouse;
+}
+
+inline const takram::Vec2d& Composite::mouse_velocity() const {
+  return state().mouse_velocity;
 }
 
 #pragma mark Key
 
 inline char Composite::key() const {
-  assert(parent_);
-  return parent_->key();
+  return state().key;
 }
 
 inline std::uint32_t Composite::key_code() const {
-  assert(parent_);
-  return parent_->key_code();
+  return state().key_code;
 }
 
 inline bool Composite::key_pressed() const {
-  assert(parent_);
-  return parent_->key_pressed();
+  return state().key_pressed;
 }
 
 #pragma mark Touches
 
 inline const takram::Vec2d& Composite::touch() const {
-  assert(parent_);
-  return parent_->touch();
+  return state().touch;
 }
 
 inline const takram::Vec2d& Composite::ptouch() const {
-  assert(parent_);
-  return parent_->ptouch();
+  return state().ptouch;
 }
 
 inline bool Composite::touch_pressed() const {
-  assert(parent_);
-  return parent_->touch_pressed();
+  return state().touch_pressed;
+}
+
+inline const takram::Vec2d& Composite::predicted_touch() const {
+  return state().predicted_touch;
+}
+
+inline const takram::Vec2d& Composite::touch_velocity() const {
+  return state().touch_velocity;
 }
 
 #pragma mark Aggregation
@@ -219,6 +275,13 @@ inline Composite * Composite::parent() const {
   return parent_;
 }
 
+inline Composite * Composite::root() const {
+  if (state_) {
+    return state_->root;
+  }
+  return const_cast<Composite *>(this);
+}
+
 }  // namespace solas
 
 #endif  // SOLAS_COMPOSITE_H_
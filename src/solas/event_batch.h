@@ -0,0 +1,144 @@
+//
+//  solas/event_batch.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_BATCH_H_
+#define SOLAS_EVENT_BATCH_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "solas/event_holder.h"
+#include "solas/gesture_event.h"
+#include "solas/key_event.h"
+#include "solas/motion_event.h"
+#include "solas/mouse_event.h"
+#include "solas/payload_pool.h"
+#include "solas/span.h"
+#include "solas/touch_event.h"
+
+namespace solas {
+
+// Collects the events handled in a frame into contiguous arrays of each type,
+// for handlers that process them at once. Only the enabled types of event are
+// collected, and their payloads are moved rather than copied.
+class EventBatch final {
+ public:
+  EventBatch() : enabled_() {}
+
+  // Disallow copy semantics
+  EventBatch(const EventBatch&) = delete;
+  EventBatch& operator=(const EventBatch&) = delete;
+
+  // Move semantics
+  EventBatch(EventBatch&&) = default;
+  EventBatch& operator=(EventBatch&&) = default;
+
+  // Enabling
+  void enable(EventHolder::Type type);
+  bool enabled(EventHolder::Type type) const;
+  bool enabled() const { return enabled_; }
+
+  // Modifiers
+  void collect(EventHolder& event);
+  void recycle();
+
+  // Element access
+  Span<const MouseEvent> mouse() const { return mouse_; }
+  Span<const KeyEvent> key() const { return key_; }
+  Span<const TouchEvent> touch() const { return touch_; }
+  Span<const GestureEvent> gesture() const { return gesture_; }
+  Span<const MotionEvent> motion() const { return motion_; }
+
+ private:
+  std::uint8_t enabled_;
+  std::vector<MouseEvent> mouse_;
+  std::vector<KeyEvent> key_;
+  std::vector<TouchEvent> touch_;
+  std::vector<GestureEvent> gesture_;
+  std::vector<MotionEvent> motion_;
+};
+
+#pragma mark -
+
+inline void EventBatch::enable(EventHolder::Type type) {
+  enabled_ |= 1 << static_cast<unsigned>(type);
+}
+
+inline bool EventBatch::enabled(EventHolder::Type type) const {
+  return enabled_ & (1 << static_cast<unsigned>(type));
+}
+
+#pragma mark Modifiers
+
+inline void EventBatch::collect(EventHolder& event) {
+  if (!enabled(event.type())) {
+    return;
+  }
+  switch (event.type()) {
+    case EventHolder::Type::MOUSE:
+      mouse_.emplace_back(event.mouse());
+      break;
+    case EventHolder::Type::KEY:
+      key_.emplace_back(std::move(event.key()));
+      break;
+    case EventHolder::Type::TOUCH:
+      touch_.emplace_back(std::move(event.touch()));
+      break;
+    case EventHolder::Type::GESTURE:
+      gesture_.emplace_back(std::move(event.gesture()));
+      break;
+    case EventHolder::Type::MOTION:
+      motion_.emplace_back(event.motion());
+      break;
+    default:
+      break;
+  }
+}
+
+inline void EventBatch::recycle() {
+  auto& pool = PayloadPool::shared();
+  for (auto& event : key_) {
+    pool.recycle(event.releaseCharacters());
+  }
+  for (auto& event : touch_) {
+    pool.recycle(event.releaseTouches());
+    pool.recycle(event.releaseContacts());
+  }
+  for (auto& event : gesture_) {
+    pool.recycle(event.releaseTouches());
+  }
+  mouse_.clear();
+  key_.clear();
+  touch_.clear();
+  gesture_.clear();
+  motion_.clear();
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_BATCH_H_
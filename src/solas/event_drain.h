@@ -0,0 +1,104 @@
+//
+//  solas/event_drain.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_DRAIN_H_
+#define SOLAS_EVENT_DRAIN_H_
+
+#include <chrono>
+#include <cstddef>
+
+namespace solas {
+
+// Bounds the number of events or the time spent handling them in a frame.
+// Events beyond the budget stay in the queue for the next frame, but at least
+// the minimum number of events is always handled so that a backlog shrinks.
+class EventDrain final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // The clock is read once every this number of events
+  static constexpr std::size_t clock_interval = 8;
+
+ public:
+  EventDrain(std::size_t limit, double duration, std::size_t minimum);
+
+  // Copy semantics
+  EventDrain(const EventDrain&) = default;
+  EventDrain& operator=(const EventDrain&) = default;
+
+  // Draining
+  bool proceeds();
+  void advance() { ++count_; }
+
+  // Properties
+  std::size_t count() const { return count_; }
+  bool exhausted() const { return exhausted_; }
+
+ private:
+  std::size_t limit_;
+  std::size_t minimum_;
+  bool timed_;
+  Clock::time_point deadline_;
+  std::size_t count_;
+  bool exhausted_;
+};
+
+#pragma mark -
+
+inline EventDrain::EventDrain(std::size_t limit,
+                              double duration,
+                              std::size_t minimum)
+    : limit_(limit),
+      minimum_(minimum),
+      timed_(duration > 0.0),
+      count_(),
+      exhausted_() {
+  if (timed_) {
+    deadline_ = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(duration));
+  }
+}
+
+#pragma mark Draining
+
+inline bool EventDrain::proceeds() {
+  if (count_ < minimum_) {
+    return true;
+  }
+  if (!exhausted_) {
+    if (limit_ && count_ >= limit_) {
+      exhausted_ = true;
+    } else if (timed_ && count_ % clock_interval == 0) {
+      exhausted_ = Clock::now() >= deadline_;
+    }
+  }
+  return !exhausted_;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_DRAIN_H_
@@ -29,8 +29,9 @@
 #define SOLAS_EVENT_HOLDER_H_
 
 #include <cassert>
-
-#include <boost/any.hpp>
+#include <chrono>
+#include <new>
+#include <utility>
 
 #include "solas/gesture_event.h"
 #include "solas/key_event.h"
@@ -51,19 +52,33 @@ class EventHolder final {
     MOTION
   };
 
+  using Clock = std::chrono::steady_clock;
+
  public:
   explicit EventHolder(const MouseEvent& event);
   explicit EventHolder(const KeyEvent& event);
   explicit EventHolder(const TouchEvent& event);
   explicit EventHolder(const GestureEvent& event);
   explicit EventHolder(const MotionEvent& event);
+  explicit EventHolder(KeyEvent&& event);
+  explicit EventHolder(TouchEvent&& event);
+  explicit EventHolder(GestureEvent&& event);
+
+  ~EventHolder();
 
   // Copy semantics excluding assignment
-  EventHolder(const EventHolder&) = default;
+  EventHolder(const EventHolder& other);
   EventHolder& operator=(const EventHolder&) = delete;
 
+  // Move semantics excluding assignment
+  EventHolder(EventHolder&& other);
+  EventHolder& operator=(EventHolder&&) = delete;
+
   // Properties
   Type type() const { return type_; }
+  Clock::time_point timestamp() const;
+  Clock::time_point enqueued() const { return enqueued_; }
+  void set_enqueued(Clock::time_point value) { enqueued_ = value; }
 
   // Accessing the event
   const MouseEvent& mouse() const;
@@ -71,59 +86,217 @@ class EventHolder final {
   const TouchEvent& touch() const;
   const GestureEvent& gesture() const;
   const MotionEvent& motion() const;
+  MouseEvent& mouse();
+  KeyEvent& key();
+  TouchEvent& touch();
+  GestureEvent& gesture();
+  MotionEvent& motion();
+
+ private:
+  // Stores the event in place, so that holding an event doesn't allocate
+  // anything in addition to what the event itself owns.
+  union Storage {
+    Storage() {}
+    ~Storage() {}
+    MouseEvent mouse;
+    KeyEvent key;
+    TouchEvent touch;
+    GestureEvent gesture;
+    MotionEvent motion;
+  };
 
  private:
   Type type_;
-  boost::any event_;
+  Storage storage_;
+  Clock::time_point enqueued_;
 };
 
 #pragma mark -
 
 inline EventHolder::EventHolder(const MouseEvent& event)
-    : type_(Type::MOUSE),
-      event_(event) {}
+    : type_(Type::MOUSE) {
+  new (&storage_.mouse) MouseEvent(event);
+}
 
 inline EventHolder::EventHolder(const KeyEvent& event)
-    : type_(Type::KEY),
-      event_(event) {}
+    : type_(Type::KEY) {
+  new (&storage_.key) KeyEvent(event);
+}
 
 inline EventHolder::EventHolder(const TouchEvent& event)
-    : type_(Type::TOUCH),
-      event_(event) {}
+    : type_(Type::TOUCH) {
+  new (&storage_.touch) TouchEvent(event);
+}
 
 inline EventHolder::EventHolder(const GestureEvent& event)
-    : type_(Type::GESTURE),
-      event_(event) {}
+    : type_(Type::GESTURE) {
+  new (&storage_.gesture) GestureEvent(event);
+}
 
 inline EventHolder::EventHolder(const MotionEvent& event)
-    : type_(Type::MOTION),
-      event_(event) {}
+    : type_(Type::MOTION) {
+  new (&storage_.motion) MotionEvent(event);
+}
+
+inline EventHolder::EventHolder(KeyEvent&& event)
+    : type_(Type::KEY) {
+  new (&storage_.key) KeyEvent(std::move(event));
+}
+
+inline EventHolder::EventHolder(TouchEvent&& event)
+    : type_(Type::TOUCH) {
+  new (&storage_.touch) TouchEvent(std::move(event));
+}
+
+inline EventHolder::EventHolder(GestureEvent&& event)
+    : type_(Type::GESTURE) {
+  new (&storage_.gesture) GestureEvent(std::move(event));
+}
+
+inline EventHolder::EventHolder(const EventHolder& other)
+    : type_(other.type_),
+      enqueued_(other.enqueued_) {
+  switch (type_) {
+    case Type::MOUSE:
+      new (&storage_.mouse) MouseEvent(other.storage_.mouse);
+      break;
+    case Type::KEY:
+      new (&storage_.key) KeyEvent(other.storage_.key);
+      break;
+    case Type::TOUCH:
+      new (&storage_.touch) TouchEvent(other.storage_.touch);
+      break;
+    case Type::GESTURE:
+      new (&storage_.gesture) GestureEvent(other.storage_.gesture);
+      break;
+    case Type::MOTION:
+      new (&storage_.motion) MotionEvent(other.storage_.motion);
+      break;
+    default:
+      assert(false);
+      break;
+  }
+}
+
+inline EventHolder::EventHolder(EventHolder&& other)
+    : type_(other.type_),
+      enqueued_(other.enqueued_) {
+  switch (type_) {
+    case Type::MOUSE:
+      new (&storage_.mouse) MouseEvent(std::move(other.storage_.mouse));
+      break;
+    case Type::KEY:
+      new (&storage_.key) KeyEvent(std::move(other.storage_.key));
+      break;
+    case Type::TOUCH:
+      new (&storage_.touch) TouchEvent(std::move(other.storage_.touch));
+      break;
+    case Type::GESTURE:
+      new (&storage_.gesture) GestureEvent(std::move(other.storage_.gesture));
+      break;
+    case Type::MOTION:
+      new (&storage_.motion) MotionEvent(std::move(other.storage_.motion));
+      break;
+    default:
+      assert(false);
+      break;
+  }
+}
+
+inline EventHolder::~EventHolder() {
+  switch (type_) {
+    case Type::MOUSE:
+      storage_.mouse.~MouseEvent();
+      break;
+    case Type::KEY:
+      storage_.key.~KeyEvent();
+      break;
+    case Type::TOUCH:
+      storage_.touch.~TouchEvent();
+      break;
+    case Type::GESTURE:
+      storage_.gesture.~GestureEvent();
+      break;
+    case Type::MOTION:
+      storage_.motion.~MotionEvent();
+      break;
+    default:
+      assert(false);
+      break;
+  }
+}
+
+#pragma mark Properties
+
+inline EventHolder::Clock::time_point EventHolder::timestamp() const {
+  switch (type_) {
+    case Type::MOUSE:
+      return storage_.mouse.timestamp();
+    case Type::KEY:
+      return storage_.key.timestamp();
+    case Type::TOUCH:
+      return storage_.touch.timestamp();
+    case Type::GESTURE:
+      return storage_.gesture.timestamp();
+    case Type::MOTION:
+      return storage_.motion.timestamp();
+    default:
+      assert(false);
+      break;
+  }
+  return Clock::time_point();
+}
 
 #pragma mark Accessing the event
 
 inline const MouseEvent& EventHolder::mouse() const {
   assert(type_ == Type::MOUSE);
-  return *boost::any_cast<MouseEvent>(&event_);
+  return storage_.mouse;
 }
 
 inline const KeyEvent& EventHolder::key() const {
   assert(type_ == Type::KEY);
-  return *boost::any_cast<KeyEvent>(&event_);
+  return storage_.key;
 }
 
 inline const TouchEvent& EventHolder::touch() const {
   assert(type_ == Type::TOUCH);
-  return *boost::any_cast<TouchEvent>(&event_);
+  return storage_.touch;
 }
 
 inline const GestureEvent& EventHolder::gesture() const {
   assert(type_ == Type::GESTURE);
-  return *boost::any_cast<GestureEvent>(&event_);
+  return storage_.gesture;
 }
 
 inline const MotionEvent& EventHolder::motion() const {
   assert(type_ == Type::MOTION);
-  return *boost::any_cast<MotionEvent>(&event_);
+  return storage_.motion;
+}
+
+inline MouseEvent& EventHolder::mouse() {
+  assert(type_ == Type::MOUSE);
+  return storage_.mouse;
+}
+
+inline KeyEvent& EventHolder::key() {
+  assert(type_ == Type::KEY);
+  return storage_.key;
+}
+
+inline TouchEvent& EventHolder::touch() {
+  assert(type_ == Type::TOUCH);
+  return storage_.touch;
+}
+
+inline GestureEvent& EventHolder::gesture() {
+  assert(type_ == Type::GESTURE);
+  return storage_.gesture;
+}
+
+inline MotionEvent& EventHolder::motion() {
+  assert(type_ == Type::MOTION);
+  return storage_.motion;
 }
 
 }  // namespace solas
@@ -0,0 +1,100 @@
+//
+//  solas/event_hook.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_HOOK_H_
+#define SOLAS_EVENT_HOOK_H_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace solas {
+
+// Maps each type of event to a plain function that forwards the event to the
+// handlers of its owner. Types without handlers hold null, and calling them
+// costs a single comparison.
+template <class Owner, class Event, typename Event::Type Last>
+class EventHookTable final {
+ public:
+  using Type = typename Event::Type;
+  using Hook = void (*)(Owner&, const Event&);
+
+ public:
+  EventHookTable() : hooks_() {}
+
+  // Copy semantics
+  EventHookTable(const EventHookTable&) = default;
+  EventHookTable& operator=(const EventHookTable&) = default;
+
+  // Element access
+  Hook& operator[](Type type);
+  Hook operator[](Type type) const;
+
+  // Invocation
+  void operator()(Owner& owner, const Event& event) const;
+  void operator()(Type type, Owner& owner, const Event& event) const;
+
+ private:
+  std::array<Hook, static_cast<std::size_t>(Last) + 1> hooks_;
+};
+
+#pragma mark -
+
+template <class Owner, class Event, typename Event::Type Last>
+inline typename EventHookTable<Owner, Event, Last>::Hook&
+    EventHookTable<Owner, Event, Last>::operator[](Type type) {
+  assert(static_cast<std::size_t>(type) < hooks_.size());
+  return hooks_[static_cast<std::size_t>(type)];
+}
+
+template <class Owner, class Event, typename Event::Type Last>
+inline typename EventHookTable<Owner, Event, Last>::Hook
+    EventHookTable<Owner, Event, Last>::operator[](Type type) const {
+  assert(static_cast<std::size_t>(type) < hooks_.size());
+  return hooks_[static_cast<std::size_t>(type)];
+}
+
+#pragma mark Invocation
+
+template <class Owner, class Event, typename Event::Type Last>
+inline void EventHookTable<Owner, Event, Last>::operator()(
+    Owner& owner, const Event& event) const {
+  (*this)(event.type(), owner, event);
+}
+
+template <class Owner, class Event, typename Event::Type Last>
+inline void EventHookTable<Owner, Event, Last>::operator()(
+    Type type, Owner& owner, const Event& event) const {
+  const auto hook = (*this)[type];
+  if (hook) {
+    hook(owner, event);
+  }
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_HOOK_H_
@@ -0,0 +1,104 @@
+//
+//  solas/event_latency.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_LATENCY_H_
+#define SOLAS_EVENT_LATENCY_H_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+#include "solas/event_holder.h"
+#include "solas/latency_histogram.h"
+#include "solas/latency_stage.h"
+
+namespace solas {
+
+// Latency histograms for every type of event and stage it passes through
+class EventLatency final {
+ public:
+  using Clock = LatencyHistogram::Clock;
+
+  static constexpr std::size_t types = 5;
+  static constexpr std::size_t stages = 3;
+
+ public:
+  EventLatency() = default;
+
+  // Copy semantics
+  EventLatency(const EventLatency&) = default;
+  EventLatency& operator=(const EventLatency&) = default;
+
+  // Recording
+  void record(EventHolder::Type type,
+              LatencyStage stage,
+              Clock::duration latency);
+  void reset();
+
+  // Histograms
+  const LatencyHistogram& histogram(EventHolder::Type type,
+                                    LatencyStage stage) const;
+
+ private:
+  static std::size_t index(EventHolder::Type type, LatencyStage stage);
+
+ private:
+  std::array<LatencyHistogram, types * stages> histograms_;
+};
+
+#pragma mark -
+
+inline void EventLatency::record(EventHolder::Type type,
+                                 LatencyStage stage,
+                                 Clock::duration latency) {
+  histograms_[index(type, stage)].record(latency);
+}
+
+inline void EventLatency::reset() {
+  for (auto& histogram : histograms_) {
+    histogram.reset();
+  }
+}
+
+#pragma mark Histograms
+
+inline const LatencyHistogram& EventLatency::histogram(
+    EventHolder::Type type, LatencyStage stage) const {
+  return histograms_[index(type, stage)];
+}
+
+inline std::size_t EventLatency::index(EventHolder::Type type,
+                                       LatencyStage stage) {
+  const auto result = (static_cast<std::size_t>(type) * stages +
+                       static_cast<std::size_t>(stage));
+  assert(result < types * stages);
+  return result;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_LATENCY_H_
@@ -0,0 +1,55 @@
+//
+//  solas/event_log.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_LOG_H_
+#define SOLAS_EVENT_LOG_H_
+
+#include <cstdint>
+
+#include "solas/shared_input.h"
+
+namespace solas {
+
+// Header of a recorded event log, which is followed by shared input records
+// until the end of the file. Every frame ends with a frame record that holds
+// the index of the frame, and the events before it belong to that frame.
+struct EventLogHeader {
+  static constexpr std::uint32_t magic_number = 0x534f4c52;  // SOLR
+  static constexpr std::uint32_t version_number = 1;
+
+  std::uint32_t magic;
+  std::uint32_t version;
+  std::uint32_t record_size;
+  std::uint32_t reserved[13];
+};
+
+static_assert(sizeof(EventLogHeader) == sizeof(SharedInputRecord),
+              "Event log header must be the size of a record");
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_LOG_H_
@@ -0,0 +1,145 @@
+//
+//  solas/event_mask.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_MASK_H_
+#define SOLAS_EVENT_MASK_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "solas/event_holder.h"
+#include "solas/gesture_event.h"
+#include "solas/key_event.h"
+#include "solas/motion_event.h"
+#include "solas/mouse_event.h"
+#include "solas/touch_event.h"
+
+namespace solas {
+
+// Set of event types that can be tested from any thread. It contains every
+// type until it is declared, after which only the types set are tested true.
+class EventMask final {
+ public:
+  EventMask();
+
+  // Copy semantics
+  EventMask(const EventMask& other);
+  EventMask& operator=(const EventMask& other);
+
+  // Modifiers
+  template <class Type>
+  void set(Type type);
+  void set(EventHolder::Type type);
+  void declare();
+
+  // Testing types
+  template <class Type>
+  bool test(Type type) const;
+  bool declared() const;
+
+ private:
+  static constexpr std::size_t declared_bit = 63;
+  static std::size_t bit(MouseEvent::Type type);
+  static std::size_t bit(KeyEvent::Type type);
+  static std::size_t bit(TouchEvent::Type type);
+  static std::size_t bit(GestureEvent::Type type);
+  static std::size_t bit(MotionEvent::Type type);
+
+ private:
+  std::atomic<std::uint64_t> bits_;
+};
+
+#pragma mark -
+
+inline EventMask::EventMask() : bits_() {}
+
+inline EventMask::EventMask(const EventMask& other)
+    : bits_(other.bits_.load(std::memory_order_relaxed)) {}
+
+inline EventMask& EventMask::operator=(const EventMask& other) {
+  if (&other != this) {
+    bits_.store(other.bits_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+  }
+  return *this;
+}
+
+#pragma mark Modifiers
+
+template <class Type>
+inline void EventMask::set(Type type) {
+  bits_.fetch_or(std::uint64_t(1) << bit(type), std::memory_order_relaxed);
+}
+
+inline void EventMask::set(EventHolder::Type type) {
+  // Every kind of event has a range of 8 bits in the order of holder types
+  const auto shift = 8 * static_cast<std::size_t>(type);
+  bits_.fetch_or(std::uint64_t(0xff) << shift, std::memory_order_relaxed);
+}
+
+inline void EventMask::declare() {
+  bits_.fetch_or(std::uint64_t(1) << declared_bit, std::memory_order_relaxed);
+}
+
+#pragma mark Testing types
+
+template <class Type>
+inline bool EventMask::test(Type type) const {
+  const auto bits = bits_.load(std::memory_order_relaxed);
+  return !((bits >> declared_bit) & 1) || ((bits >> bit(type)) & 1);
+}
+
+inline bool EventMask::declared() const {
+  return (bits_.load(std::memory_order_relaxed) >> declared_bit) & 1;
+}
+
+#pragma mark Bits
+
+inline std::size_t EventMask::bit(MouseEvent::Type type) {
+  return static_cast<std::size_t>(type);
+}
+
+inline std::size_t EventMask::bit(KeyEvent::Type type) {
+  return 8 + static_cast<std::size_t>(type);
+}
+
+inline std::size_t EventMask::bit(TouchEvent::Type type) {
+  return 16 + static_cast<std::size_t>(type);
+}
+
+inline std::size_t EventMask::bit(GestureEvent::Type type) {
+  return 24 + static_cast<std::size_t>(type);
+}
+
+inline std::size_t EventMask::bit(MotionEvent::Type type) {
+  return 32 + static_cast<std::size_t>(type);
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_MASK_H_
@@ -0,0 +1,62 @@
+//
+//  solas/event_overflow.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_OVERFLOW_H_
+#define SOLAS_EVENT_OVERFLOW_H_
+
+#include <cassert>
+#include <ostream>
+
+namespace solas {
+
+enum class EventOverflow : int {
+  DROP_OLDEST,
+  COALESCE,
+  BLOCK
+};
+
+inline std::ostream& operator<<(std::ostream& os, EventOverflow overflow) {
+  switch (overflow) {
+    case EventOverflow::DROP_OLDEST:
+      os << "drop oldest";
+      break;
+    case EventOverflow::COALESCE:
+      os << "coalesce";
+      break;
+    case EventOverflow::BLOCK:
+      os << "block";
+      break;
+    default:
+      assert(false);
+      break;
+  }
+  return os;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_OVERFLOW_H_
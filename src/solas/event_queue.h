@@ -0,0 +1,353 @@
+//
+//  solas/event_queue.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_QUEUE_H_
+#define SOLAS_EVENT_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <boost/optional.hpp>
+
+#include "solas/event_holder.h"
+#include "solas/event_overflow.h"
+#include "solas/mouse_event.h"
+#include "solas/payload_pool.h"
+#include "solas/touch_event.h"
+
+namespace solas {
+
+// Bounded lock-free queue that any number of threads can push events into,
+// while the thread that runs the view pops them. The capacity is rounded up
+// to a power of two. Until it is first popped, nothing blocks on the queue
+// because there is no consumer to make room yet.
+class EventQueue final {
+ public:
+  static constexpr std::size_t default_capacity = 1024;
+
+ public:
+  EventQueue();
+  explicit EventQueue(std::size_t capacity,
+                      EventOverflow overflow = EventOverflow::DROP_OLDEST);
+  ~EventQueue();
+
+  // Disallow copy semantics
+  EventQueue(const EventQueue&) = delete;
+  EventQueue& operator=(const EventQueue&) = delete;
+
+  // Modifiers
+  template <class Event>
+  void push(Event&& event,
+            EventHolder::Clock::time_point enqueued =
+                EventHolder::Clock::time_point());
+  bool pop(boost::optional<EventHolder>& event);
+
+  // Properties
+  std::size_t capacity() const { return mask_ + 1; }
+  EventOverflow overflow() const { return overflow_; }
+  bool empty() const;
+  std::size_t size() const;
+
+  // Statistics
+  std::size_t dropped() const { return dropped_; }
+  std::size_t coalesced() const { return coalesced_; }
+  std::size_t blocked() const { return blocked_; }
+
+ private:
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    typename std::aligned_storage<
+        sizeof(EventHolder), alignof(EventHolder)>::type storage;
+  };
+
+  static std::size_t roundCapacity(std::size_t capacity);
+  static bool coalescable(const EventHolder& event);
+  template <class Event>
+  bool tryPush(Event&& event, EventHolder::Clock::time_point enqueued);
+  void pushOverflowing(EventHolder&& event);
+  bool tryPop(boost::optional<EventHolder> *event);
+  bool dropOldest();
+  void coalesce(EventHolder&& event);
+  bool flushCoalesced();
+
+ private:
+  std::size_t mask_;
+  EventOverflow overflow_;
+  std::unique_ptr<Cell[]> cells_;
+
+  // Keep the positions apart to avoid false sharing between producers and
+  // the consumer
+  std::atomic<std::size_t> enqueue_position_;
+  char enqueue_padding_[64 - sizeof(std::atomic<std::size_t>)];
+  std::atomic<std::size_t> dequeue_position_;
+  char dequeue_padding_[64 - sizeof(std::atomic<std::size_t>)];
+
+  // Blocking on the thread that pops would never return
+  std::atomic<std::thread::id> consumer_;
+
+  // The latest coalescable event that didn't fit in the cells
+  std::atomic_flag coalesced_lock_;
+  std::atomic_bool has_coalesced_;
+  boost::optional<EventHolder> coalesced_event_;
+
+  // Statistics
+  std::atomic<std::size_t> dropped_;
+  std::atomic<std::size_t> coalesced_;
+  std::atomic<std::size_t> blocked_;
+};
+
+#pragma mark -
+
+inline EventQueue::EventQueue() : EventQueue(default_capacity) {}
+
+inline EventQueue::EventQueue(std::size_t capacity, EventOverflow overflow)
+    : mask_(roundCapacity(capacity) - 1),
+      overflow_(overflow),
+      cells_(new Cell[mask_ + 1]),
+      enqueue_position_(),
+      enqueue_padding_(),
+      dequeue_position_(),
+      dequeue_padding_(),
+      consumer_(std::thread::id()),
+      coalesced_lock_(ATOMIC_FLAG_INIT),
+      has_coalesced_(false),
+      dropped_(),
+      coalesced_(),
+      blocked_() {
+  for (std::size_t i = 0; i <= mask_; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+inline EventQueue::~EventQueue() {
+  while (tryPop(nullptr)) {}
+}
+
+#pragma mark Modifiers
+
+template <class Event>
+inline void EventQueue::push(Event&& event,
+                             EventHolder::Clock::time_point enqueued) {
+  // Construct the holder in the cell directly unless the queue is full. The
+  // event is only moved from once it is pushed.
+  if (!flushCoalesced() || !tryPush(std::forward<Event>(event), enqueued)) {
+    EventHolder holder(std::forward<Event>(event));
+    holder.set_enqueued(enqueued);
+    pushOverflowing(std::move(holder));
+  }
+}
+
+inline void EventQueue::pushOverflowing(EventHolder&& event) {
+  // The consumer can't make room while it is pushing, and no thread does
+  // before the queue is first popped, so both drop the oldest events instead
+  // of blocking.
+  const auto consumer = consumer_.load(std::memory_order_relaxed);
+  if (overflow_ == EventOverflow::BLOCK &&
+      consumer != std::thread::id() &&
+      consumer != std::this_thread::get_id()) {
+    ++blocked_;
+    while (!flushCoalesced() ||
+           !tryPush(std::move(event), event.enqueued())) {
+      std::this_thread::yield();
+    }
+    return;
+  }
+  if (overflow_ == EventOverflow::COALESCE && coalescable(event)) {
+    coalesce(std::move(event));
+    return;
+  }
+  do {
+    dropOldest();
+  } while (!flushCoalesced() ||
+           !tryPush(std::move(event), event.enqueued()));
+}
+
+inline bool EventQueue::pop(boost::optional<EventHolder>& event) {
+  consumer_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  event = boost::none;
+  if (tryPop(&event)) {
+    return true;
+  }
+  if (has_coalesced_.load(std::memory_order_acquire)) {
+    while (coalesced_lock_.test_and_set(std::memory_order_acquire)) {}
+    if (coalesced_event_) {
+      event.emplace(std::move(*coalesced_event_));
+      coalesced_event_ = boost::none;
+    }
+    has_coalesced_.store(false, std::memory_order_relaxed);
+    coalesced_lock_.clear(std::memory_order_release);
+    return static_cast<bool>(event);
+  }
+  return false;
+}
+
+inline void EventQueue::coalesce(EventHolder&& event) {
+  while (coalesced_lock_.test_and_set(std::memory_order_acquire)) {}
+  if (coalesced_event_) {
+    ++coalesced_;
+    PayloadPool::shared().recycle(*coalesced_event_);
+  }
+  coalesced_event_.emplace(std::move(event));
+  has_coalesced_.store(true, std::memory_order_release);
+  coalesced_lock_.clear(std::memory_order_release);
+}
+
+inline bool EventQueue::flushCoalesced() {
+  // The coalesced event is the latest one in the queue, so it has to move
+  // into the cells before anything else is pushed after it.
+  if (!has_coalesced_.load(std::memory_order_acquire)) {
+    return true;
+  }
+  while (coalesced_lock_.test_and_set(std::memory_order_acquire)) {}
+  bool flushed = true;
+  if (coalesced_event_) {
+    const auto enqueued = coalesced_event_->enqueued();
+    flushed = tryPush(std::move(*coalesced_event_), enqueued);
+    if (flushed) {
+      coalesced_event_ = boost::none;
+    }
+  }
+  if (flushed) {
+    has_coalesced_.store(false, std::memory_order_relaxed);
+  }
+  coalesced_lock_.clear(std::memory_order_release);
+  return flushed;
+}
+
+#pragma mark Properties
+
+inline bool EventQueue::empty() const {
+  const auto position = dequeue_position_.load(std::memory_order_relaxed);
+  const auto& cell = cells_[position & mask_];
+  return (cell.sequence.load(std::memory_order_acquire) != position + 1 &&
+          !has_coalesced_.load(std::memory_order_acquire));
+}
+
+inline std::size_t EventQueue::size() const {
+  // Approximate while producers are pushing, because it counts cells that are
+  // claimed but not yet filled.
+  const auto dequeue = dequeue_position_.load(std::memory_order_acquire);
+  const auto enqueue = enqueue_position_.load(std::memory_order_acquire);
+  const std::size_t coalesced =
+      has_coalesced_.load(std::memory_order_acquire) ? 1 : 0;
+  return (enqueue > dequeue ? enqueue - dequeue : 0) + coalesced;
+}
+
+#pragma mark Cells
+
+inline std::size_t EventQueue::roundCapacity(std::size_t capacity) {
+  std::size_t result = 2;
+  while (result < capacity) {
+    result <<= 1;
+  }
+  return result;
+}
+
+inline bool EventQueue::coalescable(const EventHolder& event) {
+  switch (event.type()) {
+    case EventHolder::Type::MOUSE:
+      return (event.mouse().type() == MouseEvent::Type::MOVED ||
+              event.mouse().type() == MouseEvent::Type::DRAGGED);
+    case EventHolder::Type::TOUCH:
+      return event.touch().type() == TouchEvent::Type::MOVED;
+    default:
+      break;
+  }
+  return false;
+}
+
+template <class Event>
+inline bool EventQueue::tryPush(Event&& event,
+                                EventHolder::Clock::time_point enqueued) {
+  auto position = enqueue_position_.load(std::memory_order_relaxed);
+  while (true) {
+    auto& cell = cells_[position & mask_];
+    const auto sequence = cell.sequence.load(std::memory_order_acquire);
+    const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+    if (!difference) {
+      if (enqueue_position_.compare_exchange_weak(
+              position, position + 1, std::memory_order_relaxed)) {
+        auto holder = new (&cell.storage) EventHolder(
+            std::forward<Event>(event));
+        holder->set_enqueued(enqueued);
+        cell.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (difference < 0) {
+      return false;  // Full
+    } else {
+      position = enqueue_position_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+inline bool EventQueue::tryPop(boost::optional<EventHolder> *event) {
+  auto position = dequeue_position_.load(std::memory_order_relaxed);
+  while (true) {
+    auto& cell = cells_[position & mask_];
+    const auto sequence = cell.sequence.load(std::memory_order_acquire);
+    const auto difference =
+        static_cast<std::ptrdiff_t>(sequence - (position + 1));
+    if (!difference) {
+      if (dequeue_position_.compare_exchange_weak(
+              position, position + 1, std::memory_order_relaxed)) {
+        auto holder = reinterpret_cast<EventHolder *>(&cell.storage);
+        if (event) {
+          event->emplace(std::move(*holder));
+        }
+        holder->~EventHolder();
+        cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (difference < 0) {
+      return false;  // Empty
+    } else {
+      position = dequeue_position_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+inline bool EventQueue::dropOldest() {
+  // Return the payloads of the dropped event to the pool, which would
+  // otherwise run dry while the queue keeps overflowing
+  boost::optional<EventHolder> event;
+  if (!tryPop(&event)) {
+    return false;
+  }
+  ++dropped_;
+  PayloadPool::shared().recycle(*event);
+  return true;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_QUEUE_H_
@@ -0,0 +1,205 @@
+//
+//  solas/event_recorder.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/event_recorder.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+#include "solas/event_log.h"
+#include "solas/gesture_event.h"
+#include "solas/key_event.h"
+#include "solas/motion_event.h"
+#include "solas/mouse_event.h"
+#include "solas/shared_input.h"
+#include "solas/shared_input_codec.h"
+#include "solas/touch_event.h"
+
+namespace solas {
+
+namespace {
+
+bool writeAll(int descriptor, const void *data, std::size_t size) {
+  auto bytes = static_cast<const char *>(data);
+  while (size) {
+    const auto written = ::write(descriptor, bytes, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    bytes += written;
+    size -= written;
+  }
+  return true;
+}
+
+}  // namespace
+
+EventRecorder::EventRecorder()
+    : descriptor_(-1),
+      size_(),
+      failed_(false),
+      frames_(),
+      records_() {}
+
+EventRecorder::~EventRecorder() {
+  close();
+}
+
+#pragma mark Opening the log
+
+bool EventRecorder::open(const std::string& path, std::size_t buffer_size) {
+  close();
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto descriptor = ::open(path.c_str(),
+                                 O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (descriptor < 0) {
+    return false;
+  }
+  EventLogHeader header = {};
+  header.magic = EventLogHeader::magic_number;
+  header.version = EventLogHeader::version_number;
+  header.record_size = sizeof(SharedInputRecord);
+  if (!writeAll(descriptor, &header, sizeof(header))) {
+    ::close(descriptor);
+    return false;
+  }
+  path_ = path;
+  descriptor_ = descriptor;
+  buffer_.resize(std::max<std::size_t>(buffer_size, 1));
+  size_ = 0;
+  failed_ = false;
+  frames_ = 0;
+  records_ = 0;
+  return true;
+}
+
+bool EventRecorder::close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (descriptor_ < 0) {
+    return !failed_;
+  }
+  write();
+  if (::close(descriptor_)) {
+    failed_ = true;
+  }
+  descriptor_ = -1;
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+  return !failed_;
+}
+
+#pragma mark Recording
+
+void EventRecorder::record(const MouseEvent& event) {
+  encode(event);
+}
+
+void EventRecorder::record(const KeyEvent& event) {
+  encode(event);
+}
+
+void EventRecorder::record(const TouchEvent& event) {
+  encode(event);
+}
+
+void EventRecorder::record(const GestureEvent& event) {
+  encode(event);
+}
+
+void EventRecorder::record(const MotionEvent& event) {
+  encode(event);
+}
+
+void EventRecorder::recordFrame() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (descriptor_ < 0) {
+    return;
+  }
+  if (size_ == buffer_.size()) {
+    write();
+  }
+  auto& record = buffer_[size_++];
+  std::memset(&record, 0, sizeof(record));
+  record.kind = SharedInputRecord::Kind::FRAME;
+  record.timestamp = SharedInputCodec::timestamp(Clock::now());
+  record.values[0] = frames_++;
+  ++records_;
+}
+
+bool EventRecorder::flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (descriptor_ >= 0) {
+    write();
+  }
+  return !failed_;
+}
+
+#pragma mark Writing records
+
+template <class Event>
+void EventRecorder::encode(const Event& event) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (descriptor_ < 0) {
+    return;
+  }
+  // Events of more records than the buffer holds are dropped
+  const auto size = SharedInputCodec::size(event);
+  if (size > buffer_.size()) {
+    return;
+  }
+  if (size_ + size > buffer_.size()) {
+    write();
+  }
+  const auto records = &buffer_[size_];
+  SharedInputCodec::encode(event, [records](std::size_t index) -> auto& {
+    return records[index];
+  });
+  size_ += size;
+  records_ += size;
+}
+
+void EventRecorder::write() {
+  // Records after a failed write are discarded, because a log with a gap in
+  // it can't be replayed past the gap anyway.
+  if (!failed_ && !writeAll(descriptor_, buffer_.data(),
+                            size_ * sizeof(SharedInputRecord))) {
+    failed_ = true;
+  }
+  size_ = 0;
+}
+
+}  // namespace solas
@@ -0,0 +1,105 @@
+//
+//  solas/event_recorder.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_RECORDER_H_
+#define SOLAS_EVENT_RECORDER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "solas/gesture_event.h"
+#include "solas/key_event.h"
+#include "solas/motion_event.h"
+#include "solas/mouse_event.h"
+#include "solas/shared_input.h"
+#include "solas/touch_event.h"
+
+namespace solas {
+
+// Appends every event that a runner receives to a binary log, together with
+// the end of each frame, so that an event replayer can feed them to another
+// runner at the same frames. Records are collected in a buffer that is
+// written to the file only when it fills up. Once a write fails, the log is
+// no longer recorded to, and flush(), close() and ok() report the failure.
+class EventRecorder final {
+ public:
+  using Clock = std::chrono::steady_clock;
+  static constexpr std::size_t default_buffer_size = 16384;
+
+ public:
+  EventRecorder();
+  ~EventRecorder();
+
+  // Disallow copy semantics
+  EventRecorder(const EventRecorder&) = delete;
+  EventRecorder& operator=(const EventRecorder&) = delete;
+
+  // Opening the log
+  bool open(const std::string& path,
+            std::size_t buffer_size = default_buffer_size);
+  bool close();
+  bool is_open() const { return descriptor_ >= 0; }
+  bool ok() const { return !failed_; }
+
+  // Recording
+  void record(const MouseEvent& event);
+  void record(const KeyEvent& event);
+  void record(const TouchEvent& event);
+  void record(const GestureEvent& event);
+  void record(const MotionEvent& event);
+  void recordFrame();
+  bool flush();
+
+  // Properties
+  const std::string& path() const { return path_; }
+  std::uint64_t frames() const { return frames_; }
+  std::uint64_t records() const { return records_; }
+
+ private:
+  // Writing records
+  template <class Event>
+  void encode(const Event& event);
+  void write();
+
+ private:
+  std::string path_;
+  int descriptor_;
+  std::vector<SharedInputRecord> buffer_;
+  std::size_t size_;
+  bool failed_;
+  std::uint64_t frames_;
+  std::uint64_t records_;
+  std::mutex mutex_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_RECORDER_H_
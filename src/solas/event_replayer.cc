@@ -0,0 +1,123 @@
+//
+//  solas/event_replayer.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/event_replayer.h"
+
+#include <cstddef>
+#include <string>
+
+#include "solas/event_log.h"
+#include "solas/runner.h"
+#include "solas/shared_input.h"
+#include "solas/shared_input_codec.h"
+
+namespace solas {
+
+EventReplayer::EventReplayer()
+    : records_(),
+      size_(),
+      position_(),
+      frame_(),
+      rebases_timestamps_(true) {}
+
+#pragma mark Opening the log
+
+bool EventReplayer::open(const std::string& path) {
+  close();
+  if (!file_.open(path, true)) {
+    return false;
+  }
+  const auto header = static_cast<const EventLogHeader *>(file_.data());
+  if (file_.size() < sizeof(EventLogHeader) ||
+      header->magic != EventLogHeader::magic_number ||
+      header->version != EventLogHeader::version_number ||
+      header->record_size != sizeof(SharedInputRecord)) {
+    file_.close();
+    return false;
+  }
+  // A record that was partially written is left out
+  records_ = reinterpret_cast<const SharedInputRecord *>(header + 1);
+  size_ = (file_.size() - sizeof(EventLogHeader)) / sizeof(SharedInputRecord);
+  rewind();
+  return true;
+}
+
+void EventReplayer::close() {
+  records_ = nullptr;
+  size_ = 0;
+  position_ = 0;
+  frame_ = 0;
+  file_.close();
+}
+
+#pragma mark Replaying
+
+void EventReplayer::rewind() {
+  position_ = 0;
+  frame_ = 0;
+}
+
+#pragma mark Polling events
+
+void EventReplayer::poll(Runner& runner) {
+  if (finished()) {
+    return;
+  }
+  // Find the end of the frame first, which tells how long ago its events
+  // happened relative to the frame. The log may end in the middle of a frame
+  // or even of an event when the recording was cut off.
+  auto end = position_;
+  auto time = records_[end].timestamp;
+  while (end < size_ &&
+         records_[end].kind != SharedInputRecord::Kind::FRAME) {
+    const auto next = end + records_[end].count + 1;
+    if (next > size_) {
+      size_ = end;
+      break;
+    }
+    time = records_[end].timestamp;
+    end = next;
+  }
+  if (end < size_) {
+    time = records_[end].timestamp;
+  }
+  auto offset = SharedInputCodec::Clock::duration::zero();
+  if (rebases_timestamps_) {
+    offset = (SharedInputCodec::Clock::now() -
+              SharedInputCodec::time_point(time));
+  }
+  for (auto index = position_; index < end;
+       index += records_[index].count + 1) {
+    SharedInputCodec::dispatch(runner, [this, index](std::size_t offset)
+        -> const SharedInputRecord& {
+      return records_[index + offset];
+    }, offset);
+  }
+  position_ = end < size_ ? end + 1 : size_;
+  ++frame_;
+}
+
+}  // namespace solas
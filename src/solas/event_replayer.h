@@ -0,0 +1,80 @@
+//
+//  solas/event_replayer.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_REPLAYER_H_
+#define SOLAS_EVENT_REPLAYER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "solas/input_source.h"
+#include "solas/mapped_file.h"
+#include "solas/shared_input.h"
+
+namespace solas {
+
+class Runner;
+
+// Feeds a log that an event recorder wrote back to a runner, one recorded
+// frame per frame, so that the runnable receives the same events at the same
+// frames however fast the runner draws. The log is mapped into memory and
+// read as it is replayed, without parsing it in advance.
+class EventReplayer final : public InputSource {
+ public:
+  EventReplayer();
+
+  // Opening the log
+  bool open(const std::string& path);
+  void close();
+  bool is_open() const { return records_; }
+
+  // Polling events
+  void poll(Runner& runner) override;
+
+  // Replaying
+  void rewind();
+  bool finished() const { return position_ >= size_; }
+
+  // Properties
+  const std::string& path() const { return file_.path(); }
+  std::uint64_t frame() const { return frame_; }
+  bool rebases_timestamps() const { return rebases_timestamps_; }
+  void set_rebases_timestamps(bool value) { rebases_timestamps_ = value; }
+
+ private:
+  MappedFile file_;
+  const SharedInputRecord *records_;
+  std::size_t size_;
+  std::size_t position_;
+  std::uint64_t frame_;
+  bool rebases_timestamps_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_REPLAYER_H_
@@ -0,0 +1,334 @@
+//
+//  solas/event_signal.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_EVENT_SIGNAL_H_
+#define SOLAS_EVENT_SIGNAL_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace solas {
+
+class EventSlotState {
+ public:
+  EventSlotState() : connected_(true) {}
+  virtual ~EventSlotState() = default;
+
+  // Disallow copy semantics
+  EventSlotState(const EventSlotState&) = delete;
+  EventSlotState& operator=(const EventSlotState&) = delete;
+
+  // Connection
+  bool connected() const { return connected_.load(std::memory_order_acquire); }
+  void disconnect() { connected_.store(false, std::memory_order_release); }
+
+ private:
+  std::atomic_bool connected_;
+};
+
+#pragma mark -
+
+class EventConnection {
+ public:
+  EventConnection() = default;
+  explicit EventConnection(const std::shared_ptr<EventSlotState>& state);
+
+  // Copy semantics
+  EventConnection(const EventConnection&) = default;
+  EventConnection& operator=(const EventConnection&) = default;
+
+  // Connection
+  void disconnect() const;
+  bool connected() const;
+
+ private:
+  std::weak_ptr<EventSlotState> state_;
+};
+
+#pragma mark -
+
+class ScopedEventConnection final : public EventConnection {
+ public:
+  ScopedEventConnection() = default;
+  ScopedEventConnection(const EventConnection& other);
+  ~ScopedEventConnection();
+
+  // Disallow copy semantics
+  ScopedEventConnection(const ScopedEventConnection&) = delete;
+  ScopedEventConnection& operator=(const ScopedEventConnection&) = delete;
+
+  // Move semantics
+  ScopedEventConnection(ScopedEventConnection&& other);
+  ScopedEventConnection& operator=(ScopedEventConnection&& other);
+
+  // Releasing the connection
+  EventConnection release();
+};
+
+#pragma mark -
+
+// Emits an event to the slots connected to it. Connecting and emitting are
+// expected on the thread that runs the view, whereas connections may be
+// disconnected from any thread without locking. Emitting to no slots costs
+// a single comparison.
+template <class Event>
+class EventSignal final {
+ public:
+  EventSignal() : emitting_() {}
+
+  // Disallow copy semantics
+  EventSignal(const EventSignal&) = delete;
+  EventSignal& operator=(const EventSignal&) = delete;
+
+  // Move semantics
+  EventSignal(EventSignal&&) = default;
+  EventSignal& operator=(EventSignal&&) = default;
+
+  // Connection
+  template <class Slot>
+  EventConnection connect(const Slot& slot);
+  template <class Slot>
+  void disconnect(const Slot& slot);
+  void disconnect_all_slots();
+  bool empty() const { return slots_.empty(); }
+
+  // Emission
+  void operator()(const Event& event);
+
+ private:
+  class SlotState : public EventSlotState {
+   public:
+    virtual void operator()(const Event& event) = 0;
+    virtual const void * tag() const = 0;
+  };
+
+  template <class Slot>
+  class SlotHolder final : public SlotState {
+   public:
+    explicit SlotHolder(const Slot& slot) : slot_(slot) {}
+    void operator()(const Event& event) override { slot_(event); }
+    const void * tag() const override { return &tag_; }
+    const Slot& slot() const { return slot_; }
+    static const char tag_;
+
+   private:
+    Slot slot_;
+  };
+
+  // Counts an emission in progress until it returns or a slot throws
+  class Emission final {
+   public:
+    explicit Emission(std::size_t& emitting) : emitting_(emitting) {
+      ++emitting_;
+    }
+    ~Emission() { --emitting_; }
+
+    // Disallow copy semantics
+    Emission(const Emission&) = delete;
+    Emission& operator=(const Emission&) = delete;
+
+   private:
+    std::size_t& emitting_;
+  };
+
+  void emit(const Event& event);
+  void collect();
+
+ private:
+  std::vector<std::shared_ptr<SlotState>> slots_;
+  std::size_t emitting_;
+};
+
+#pragma mark -
+
+template <class Event, typename Event::Type Last>
+class EventSignalTable final {
+ public:
+  using Type = typename Event::Type;
+
+ public:
+  EventSignalTable() = default;
+
+  // Disallow copy semantics
+  EventSignalTable(const EventSignalTable&) = delete;
+  EventSignalTable& operator=(const EventSignalTable&) = delete;
+
+  // Move semantics
+  EventSignalTable(EventSignalTable&&) = default;
+  EventSignalTable& operator=(EventSignalTable&&) = default;
+
+  // Element access
+  EventSignal<Event>& operator[](Type type);
+
+ private:
+  std::array<EventSignal<Event>, static_cast<std::size_t>(Last) + 1> signals_;
+};
+
+#pragma mark -
+
+inline EventConnection::EventConnection(
+    const std::shared_ptr<EventSlotState>& state)
+    : state_(state) {}
+
+inline void EventConnection::disconnect() const {
+  const auto state = state_.lock();
+  if (state) {
+    state->disconnect();
+  }
+}
+
+inline bool EventConnection::connected() const {
+  const auto state = state_.lock();
+  return state && state->connected();
+}
+
+#pragma mark -
+
+inline ScopedEventConnection::ScopedEventConnection(
+    const EventConnection& other)
+    : EventConnection(other) {}
+
+inline ScopedEventConnection::~ScopedEventConnection() {
+  disconnect();
+}
+
+inline ScopedEventConnection::ScopedEventConnection(
+    ScopedEventConnection&& other)
+    : EventConnection(other.release()) {}
+
+inline ScopedEventConnection& ScopedEventConnection::operator=(
+    ScopedEventConnection&& other) {
+  if (&other != this) {
+    disconnect();
+    EventConnection::operator=(other.release());
+  }
+  return *this;
+}
+
+inline EventConnection ScopedEventConnection::release() {
+  EventConnection connection(*this);
+  EventConnection::operator=(EventConnection());
+  return connection;
+}
+
+#pragma mark -
+
+template <class Event>
+template <class Slot>
+const char EventSignal<Event>::SlotHolder<Slot>::tag_ = char();
+
+#pragma mark Connection
+
+template <class Event>
+template <class Slot>
+inline EventConnection EventSignal<Event>::connect(const Slot& slot) {
+  collect();
+  slots_.emplace_back(std::make_shared<SlotHolder<Slot>>(slot));
+  return EventConnection(slots_.back());
+}
+
+template <class Event>
+template <class Slot>
+inline void EventSignal<Event>::disconnect(const Slot& slot) {
+  for (const auto& state : slots_) {
+    if (state->tag() == &SlotHolder<Slot>::tag_ &&
+        static_cast<const SlotHolder<Slot>&>(*state).slot() == slot) {
+      state->disconnect();
+    }
+  }
+  collect();
+}
+
+template <class Event>
+inline void EventSignal<Event>::disconnect_all_slots() {
+  for (const auto& state : slots_) {
+    state->disconnect();
+  }
+  collect();
+}
+
+#pragma mark Emission
+
+template <class Event>
+inline void EventSignal<Event>::operator()(const Event& event) {
+  if (!slots_.empty()) {
+    emit(event);
+  }
+}
+
+template <class Event>
+inline void EventSignal<Event>::emit(const Event& event) {
+  // Slots connected while emitting receive the next event, and the list is
+  // only compacted once the outermost emission finishes.
+  bool disconnected = false;
+  {
+    Emission emission(emitting_);
+    const auto size = slots_.size();
+    for (std::size_t i = 0; i < size; ++i) {
+      auto& state = *slots_[i];
+      if (state.connected()) {
+        state(event);
+      } else {
+        disconnected = true;
+      }
+    }
+  }
+  if (disconnected) {
+    collect();
+  }
+}
+
+template <class Event>
+inline void EventSignal<Event>::collect() {
+  if (emitting_) {
+    return;
+  }
+  slots_.erase(std::remove_if(
+      slots_.begin(), slots_.end(),
+      [](const std::shared_ptr<SlotState>& state) {
+        return !state->connected();
+      }), slots_.end());
+}
+
+#pragma mark -
+
+template <class Event, typename Event::Type Last>
+inline EventSignal<Event>& EventSignalTable<Event, Last>::operator[](
+    Type type) {
+  assert(static_cast<std::size_t>(type) < signals_.size());
+  return signals_[static_cast<std::size_t>(type)];
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_EVENT_SIGNAL_H_
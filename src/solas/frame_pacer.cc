@@ -0,0 +1,120 @@
+//
+//  solas/frame_pacer.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/frame_pacer.h"
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <time.h>
+#include <cerrno>
+#endif
+
+namespace solas {
+
+#pragma mark Scheduling
+
+void FramePacer::wait() {
+  ++frames_;
+  if (frame_rate_ <= 0.0) {
+    return;
+  }
+  const auto target = deadline();
+  const auto now = Clock::now();
+  if (now < target) {
+    sleepUntil(target);
+  }
+  advance(now, Clock::duration::zero());
+}
+
+bool FramePacer::tick(Clock::time_point now, Clock::duration tick_period) {
+  if (frame_rate_ <= 0.0) {
+    ++frames_;
+    return true;
+  }
+  // Produce a frame on the tick that is nearest to the deadline, which lets
+  // rates that don't divide the refresh rate settle into an even cadence
+  // instead of always lagging a whole tick behind.
+  if (deadline() - now >= tick_period / 2) {
+    return false;
+  }
+  ++frames_;
+  advance(now, tick_period / 2);
+  return true;
+}
+
+bool FramePacer::poll(Clock::time_point now) {
+  // Produce a frame once the deadline has passed, for callers that sleep
+  // until the earliest of several deadlines on their own. Those wake up
+  // within the spin threshold of it unless they are really late.
+  if (frame_rate_ > 0.0 && now < deadline()) {
+    return false;
+  }
+  ++frames_;
+  if (frame_rate_ > 0.0) {
+    advance(now, spin_threshold_);
+  }
+  return true;
+}
+
+void FramePacer::advance(Clock::time_point now, Clock::duration tolerance) {
+  ++index_;
+  const auto lateness = now - deadline(index_);
+  if (lateness > tolerance) {
+    ++missed_;
+    if (lateness >= period()) {
+      // Start a new grid from now rather than bursting frames to catch up
+      // with the old one.
+      reset(now);
+    }
+  }
+}
+
+void FramePacer::sleepUntil(Clock::time_point time) const {
+  const auto coarse = time - spin_threshold_;
+  if (Clock::now() < coarse) {
+#if defined(__linux__)
+    // steady_clock is backed by CLOCK_MONOTONIC, so an absolute sleep on
+    // that clock wakes up without accumulating the latency of a relative one.
+    const auto since_epoch = std::chrono::duration_cast<
+        std::chrono::nanoseconds>(coarse.time_since_epoch()).count();
+    timespec spec;
+    spec.tv_sec = since_epoch / 1000000000;
+    spec.tv_nsec = since_epoch % 1000000000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME,
+                           &spec, nullptr) == EINTR) {}
+#else
+    std::this_thread::sleep_until(coarse);
+#endif
+  }
+  while (Clock::now() < time) {
+    std::this_thread::yield();
+  }
+}
+
+}  // namespace solas
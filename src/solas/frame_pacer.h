@@ -0,0 +1,135 @@
+//
+//  solas/frame_pacer.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_FRAME_PACER_H_
+#define SOLAS_FRAME_PACER_H_
+
+#include <chrono>
+#include <cstdint>
+
+namespace solas {
+
+class FramePacer final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  FramePacer();
+  explicit FramePacer(double fps);
+
+  // Copy semantics
+  FramePacer(const FramePacer&) = default;
+  FramePacer& operator=(const FramePacer&) = default;
+
+  // Properties
+  double frame_rate() const { return frame_rate_; }
+  void set_frame_rate(double value);
+  Clock::duration period() const;
+  Clock::duration spin_threshold() const { return spin_threshold_; }
+  void set_spin_threshold(Clock::duration value) { spin_threshold_ = value; }
+
+  // Scheduling
+  void reset();
+  void reset(Clock::time_point now);
+  void wait();
+  bool tick(Clock::time_point now, Clock::duration tick_period);
+  bool poll(Clock::time_point now);
+  Clock::time_point deadline() const;
+
+  // Statistics
+  std::uint64_t frames() const { return frames_; }
+  std::uint64_t missed() const { return missed_; }
+
+ private:
+  Clock::time_point deadline(std::uint64_t index) const;
+  void advance(Clock::time_point now, Clock::duration tolerance);
+  void sleepUntil(Clock::time_point time) const;
+
+ private:
+  double frame_rate_;
+  Clock::duration spin_threshold_;
+  Clock::time_point origin_;
+  std::uint64_t index_;
+  std::uint64_t frames_;
+  std::uint64_t missed_;
+};
+
+#pragma mark -
+
+inline FramePacer::FramePacer() : FramePacer(0.0) {}
+
+inline FramePacer::FramePacer(double fps)
+    : frame_rate_(fps),
+      spin_threshold_(std::chrono::microseconds(500)),
+      origin_(Clock::now()),
+      index_(),
+      frames_(),
+      missed_() {}
+
+#pragma mark Properties
+
+inline void FramePacer::set_frame_rate(double value) {
+  if (value != frame_rate_) {
+    frame_rate_ = value;
+    reset();
+  }
+}
+
+inline FramePacer::Clock::duration FramePacer::period() const {
+  if (frame_rate_ <= 0.0) {
+    return Clock::duration::zero();
+  }
+  return std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(1.0 / frame_rate_));
+}
+
+#pragma mark Scheduling
+
+inline void FramePacer::reset() {
+  reset(Clock::now());
+}
+
+inline void FramePacer::reset(Clock::time_point now) {
+  origin_ = now;
+  index_ = 0;
+}
+
+inline FramePacer::Clock::time_point FramePacer::deadline() const {
+  return deadline(index_ + 1);
+}
+
+inline FramePacer::Clock::time_point FramePacer::deadline(
+    std::uint64_t index) const {
+  // Derive every deadline from the origin instead of accumulating periods,
+  // so that rounding of the period never builds up into drift.
+  return origin_ + std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(index / frame_rate_));
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_FRAME_PACER_H_
@@ -0,0 +1,126 @@
+//
+//  solas/frame_state.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_FRAME_STATE_H_
+#define SOLAS_FRAME_STATE_H_
+
+#include <chrono>
+#include <cstdint>
+
+#include "solas/mouse_button.h"
+#include "solas/view_state.h"
+#include "takram/math.h"
+
+namespace solas {
+
+// Snapshot of the structure and input of a view in a frame. A view publishes
+// one before drawing, and other threads read it through a frame state ring
+// while the view builds the next one.
+class FrameState final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  FrameState();
+  FrameState(const ViewState& state,
+             std::uint64_t frame,
+             Clock::time_point time);
+
+  // Copy semantics
+  FrameState(const FrameState&) = default;
+  FrameState& operator=(const FrameState&) = default;
+
+  // Frame
+  std::uint64_t frame() const { return frame_; }
+  Clock::time_point time() const { return time_; }
+
+  // Structure
+  const takram::Size2d& size() const { return state_.size; }
+  double width() const { return state_.size.width; }
+  double height() const { return state_.size.height; }
+  double scale() const { return state_.scale; }
+
+  // Mouse
+  const takram::Vec2d& mouse() const { return state_.mouse; }
+  const takram::Vec2d& pmouse() const { return state_.pmouse; }
+  MouseButton mouse_button() const { return state_.mouse_button; }
+  bool mouse_pressed() const { return state_.mouse_pressed; }
+  const takram::Vec2d& predicted_mouse() const;
+  const takram::Vec2d& mouse_velocity() const;
+
+  // Key
+  char key() const { return state_.key; }
+  std::uint32_t key_code() const { return state_.key_code; }
+  bool key_pressed() const { return state_.key_pressed; }
+
+  // Touches
+  const takram::Vec2d& touch() const { return state_.touch; }
+  const takram::Vec2d& ptouch() const { return state_.ptouch; }
+  bool touch_pressed() const { return state_.touch_pressed; }
+  const takram::Vec2d& predicted_touch() const;
+  const takram::Vec2d& touch_velocity() const;
+
+ private:
+  ViewState state_;
+  std::uint64_t frame_;
+  Clock::time_point time_;
+};
+
+#pragma mark -
+
+inline FrameState::FrameState() : frame_() {}
+
+inline FrameState::FrameState(const ViewState& state,
+                              std::uint64_t frame,
+                              Clock::time_point time)
+    : state_(state),
+      frame_(frame),
+      time_(time) {}
+
+#pragma mark Mouse
+
+inline const takram::Vec2d& FrameState::predicted_mouse() const {
+  return state_.predicted_mouse;
+}
+
+inline const takram::Vec2d& FrameState::mouse_velocity() const {
+  return state_.mouse_velocity;
+}
+
+#pragma mark Touches
+
+inline const takram::Vec2d& FrameState::predicted_touch() const {
+  return state_.predicted_touch;
+}
+
+inline const takram::Vec2d& FrameState::touch_velocity() const {
+  return state_.touch_velocity;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_FRAME_STATE_H_
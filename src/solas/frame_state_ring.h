@@ -0,0 +1,190 @@
+//
+//  solas/frame_state_ring.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_FRAME_STATE_RING_H_
+#define SOLAS_FRAME_STATE_RING_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "solas/frame_state.h"
+#include "solas/view_state.h"
+
+namespace solas {
+
+// Fixed set of frame states that a view publishes into and any number of
+// threads read from without locking. A reader holds the latest state through
+// a reference, and the view never overwrites a state that is referenced or
+// latest, so neither of them waits for the other. When readers hold on to
+// every other state, the view skips publishing instead of allocating.
+class FrameStateRing final {
+ private:
+  struct Slot {
+    std::atomic<std::size_t> references;
+    FrameState state;
+  };
+
+ public:
+  static constexpr std::size_t default_capacity = 8;
+
+  // Keeps a frame state from being overwritten while it is alive. It must not
+  // outlive the ring.
+  class Reference final {
+   public:
+    Reference() : slot_(nullptr) {}
+    ~Reference();
+
+    // Disallow copy semantics
+    Reference(const Reference&) = delete;
+    Reference& operator=(const Reference&) = delete;
+
+    // Move semantics
+    Reference(Reference&& other);
+    Reference& operator=(Reference&& other);
+
+    // Accessing the state
+    const FrameState& operator*() const { return slot_->state; }
+    const FrameState * operator->() const { return &slot_->state; }
+    const FrameState * get() const { return slot_ ? &slot_->state : nullptr; }
+
+    // Conversion
+    explicit operator bool() const { return slot_; }
+
+   private:
+    friend class FrameStateRing;
+    explicit Reference(Slot *slot) : slot_(slot) {}
+
+   private:
+    Slot *slot_;
+  };
+
+ public:
+  explicit FrameStateRing(std::size_t capacity = default_capacity);
+
+  // Disallow copy semantics
+  FrameStateRing(const FrameStateRing&) = delete;
+  FrameStateRing& operator=(const FrameStateRing&) = delete;
+
+  // Properties
+  std::size_t capacity() const { return capacity_; }
+  std::uint64_t frames() const { return frames_; }
+  std::uint64_t skipped() const { return skipped_; }
+
+  // Writer
+  bool publish(const ViewState& state, FrameState::Clock::time_point time);
+
+  // Readers
+  Reference acquire() const;
+
+ private:
+  std::unique_ptr<Slot[]> slots_;
+  std::size_t capacity_;
+  std::uint64_t frames_;
+  std::uint64_t skipped_;
+
+  // Index of the latest slot, or the capacity until the first publication
+  std::atomic<std::size_t> latest_;
+};
+
+#pragma mark -
+
+inline FrameStateRing::FrameStateRing(std::size_t capacity)
+    : slots_(new Slot[std::max<std::size_t>(capacity, 2)]),
+      capacity_(std::max<std::size_t>(capacity, 2)),
+      frames_(),
+      skipped_(),
+      latest_(capacity_) {
+  for (std::size_t i = 0; i < capacity_; ++i) {
+    slots_[i].references.store(0, std::memory_order_relaxed);
+  }
+}
+
+#pragma mark Writer
+
+inline bool FrameStateRing::publish(const ViewState& state,
+                                    FrameState::Clock::time_point time) {
+  const auto latest = latest_.load(std::memory_order_relaxed);
+  const auto first = (latest < capacity_ ? latest + 1 : 0);
+  for (std::size_t i = 0; i < capacity_; ++i) {
+    const auto index = (first + i) % capacity_;
+    auto& slot = slots_[index];
+    if (index == latest || slot.references.load()) {
+      continue;
+    }
+    // A reader that takes this slot from now on finds that it isn't the
+    // latest, and lets go of it without reading.
+    slot.state = FrameState(state, frames_++, time);
+    latest_.store(index);
+    return true;
+  }
+  ++skipped_;
+  return false;
+}
+
+#pragma mark Readers
+
+inline FrameStateRing::Reference FrameStateRing::acquire() const {
+  while (true) {
+    const auto index = latest_.load();
+    if (index == capacity_) {
+      return Reference();
+    }
+    auto& slot = slots_[index];
+    slot.references.fetch_add(1);
+    if (latest_.load() == index) {
+      return Reference(&slot);
+    }
+    slot.references.fetch_sub(1);
+  }
+}
+
+#pragma mark Reference
+
+inline FrameStateRing::Reference::~Reference() {
+  if (slot_) {
+    slot_->references.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+inline FrameStateRing::Reference::Reference(Reference&& other)
+    : slot_(other.slot_) {
+  other.slot_ = nullptr;
+}
+
+inline FrameStateRing::Reference& FrameStateRing::Reference::operator=(
+    Reference&& other) {
+  std::swap(slot_, other.slot_);
+  return *this;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_FRAME_STATE_RING_H_
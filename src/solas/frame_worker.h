@@ -0,0 +1,121 @@
+//
+//  solas/frame_worker.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_FRAME_WORKER_H_
+#define SOLAS_FRAME_WORKER_H_
+
+#include <cassert>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace solas {
+
+class FrameWorker final {
+ public:
+  explicit FrameWorker(std::function<void()>&& task);
+  ~FrameWorker();
+
+  // Disallow copy semantics
+  FrameWorker(const FrameWorker&) = delete;
+  FrameWorker& operator=(const FrameWorker&) = delete;
+
+  // Running the task
+  void post();
+  void wait();
+  bool busy() const;
+
+ private:
+  void run();
+
+ private:
+  std::function<void()> task_;
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  bool busy_;
+  bool stopping_;
+  std::thread thread_;
+};
+
+#pragma mark -
+
+inline FrameWorker::FrameWorker(std::function<void()>&& task)
+    : task_(std::move(task)),
+      busy_(false),
+      stopping_(false),
+      thread_(&FrameWorker::run, this) {}
+
+inline FrameWorker::~FrameWorker() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  thread_.join();
+}
+
+#pragma mark Running the task
+
+inline void FrameWorker::post() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    assert(!busy_);
+    busy_ = true;
+  }
+  condition_.notify_all();
+}
+
+inline void FrameWorker::wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, [this] { return !busy_; });
+}
+
+inline bool FrameWorker::busy() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return busy_;
+}
+
+inline void FrameWorker::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this] { return busy_ || stopping_; });
+    if (!busy_) {
+      break;
+    }
+    lock.unlock();
+    task_();
+    lock.lock();
+    busy_ = false;
+    condition_.notify_all();
+  }
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_FRAME_WORKER_H_
@@ -29,11 +29,14 @@
 #define SOLAS_GESTURE_EVENT_H_
 
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 #include <boost/any.hpp>
+#include <boost/variant.hpp>
 
 #include "solas/gesture_kind.h"
 #include "solas/screen_edge.h"
@@ -52,6 +55,8 @@ class GestureEvent final {
     ENDED
   };
 
+  using Clock = std::chrono::steady_clock;
+
   struct TapData {
     std::size_t taps;
     std::size_t touches;
@@ -87,20 +92,26 @@ class GestureEvent final {
   template <class Data>
   GestureEvent(Type type,
                GestureKind kind,
-               const std::vector<takram::Vec2d>& touches,
+               std::vector<takram::Vec2d> touches,
                const Data& data);
   GestureEvent(Type type,
                GestureKind kind,
-               const std::vector<takram::Vec2d>& touches,
+               std::vector<takram::Vec2d> touches,
                const boost::any& data);
 
   // Copy semantics excluding assignment
   GestureEvent(const GestureEvent&) = default;
   GestureEvent& operator=(const GestureEvent&) = delete;
 
+  // Move semantics excluding assignment
+  GestureEvent(GestureEvent&&) = default;
+  GestureEvent& operator=(GestureEvent&&) = delete;
+
   // Properties
   bool empty() const { return type_ == Type::UNDEFINED; }
   Type type() const { return type_; }
+  Clock::time_point timestamp() const { return timestamp_; }
+  void set_timestamp(Clock::time_point value) { timestamp_ = value; }
   GestureKind kind() const { return kind_; }
   const std::vector<takram::Vec2d>& touches() const { return touches_; }
 
@@ -112,14 +123,29 @@ class GestureEvent final {
   const PanData& pan() const;
   const ScreenEdgeData& screen_edge() const;
 
+  // Releasing the payload
+  std::vector<takram::Vec2d> releaseTouches() { return std::move(touches_); }
+
   // Conversion
   operator bool() const { return !empty(); }
 
+ private:
+  // Holds the data of any kind inline, so that creating events doesn't
+  // allocate memory.
+  using DataVariant = boost::variant<boost::blank,
+                                     TapData,
+                                     PinchData,
+                                     RotationData,
+                                     SwipeData,
+                                     PanData,
+                                     ScreenEdgeData>;
+
  private:
   Type type_;
   GestureKind kind_;
   std::vector<takram::Vec2d> touches_;
-  boost::any data_;
+  DataVariant data_;
+  Clock::time_point timestamp_;
 };
 
 #pragma mark -
@@ -131,52 +157,88 @@ inline GestureEvent::GestureEvent()
 template <class Data>
 inline GestureEvent::GestureEvent(Type type,
                                   GestureKind kind,
-                                  const std::vector<takram::Vec2d>& touches,
+                                  std::vector<takram::Vec2d> touches,
                                   const Data& data)
     : type_(type),
       kind_(kind),
-      touches_(touches),
-      data_(data) {}
+      touches_(std::move(touches)),
+      data_(data),
+      timestamp_(Clock::now()) {}
 
 inline GestureEvent::GestureEvent(Type type,
                                   GestureKind kind,
-                                  const std::vector<takram::Vec2d>& touches,
+                                  std::vector<takram::Vec2d> touches,
                                   const boost::any& data)
     : type_(type),
       kind_(kind),
-      touches_(touches),
-      data_(data) {}
+      touches_(std::move(touches)),
+      timestamp_(Clock::now()) {
+  switch (kind) {
+    case GestureKind::TAP:
+      if (const auto value = boost::any_cast<TapData>(&data)) {
+        data_ = *value;
+      }
+      break;
+    case GestureKind::PINCH:
+      if (const auto value = boost::any_cast<PinchData>(&data)) {
+        data_ = *value;
+      }
+      break;
+    case GestureKind::ROTATION:
+      if (const auto value = boost::any_cast<RotationData>(&data)) {
+        data_ = *value;
+      }
+      break;
+    case GestureKind::SWIPE:
+      if (const auto value = boost::any_cast<SwipeData>(&data)) {
+        data_ = *value;
+      }
+      break;
+    case GestureKind::PAN:
+      if (const auto value = boost::any_cast<PanData>(&data)) {
+        data_ = *value;
+      }
+      break;
+    case GestureKind::SCREEN_EDGE:
+      if (const auto value = boost::any_cast<ScreenEdgeData>(&data)) {
+        data_ = *value;
+      }
+      break;
+    default:
+      break;
+  }
+}
 
 #pragma mark Gesture data
 
 inline const GestureEvent::TapData& GestureEvent::tap() const {
   assert(kind_ == GestureKind::TAP);
-  return *boost::any_cast<TapData>(&data_);
+  return boost::get<TapData>(data_);
 }
 
 inline const GestureEvent::PinchData& GestureEvent::pinch() const {
   assert(kind_ == GestureKind::PINCH);
-  return *boost::any_cast<PinchData>(&data_);
+  return boost::get<PinchData>(data_);
 }
 
 inline const GestureEvent::RotationData& GestureEvent::rotation() const {
   assert(kind_ == GestureKind::ROTATION);
-  return *boost::any_cast<RotationData>(&data_);
+  return boost::get<RotationData>(data_);
 }
 
 inline const GestureEvent::SwipeData& GestureEvent::swipe() const {
   assert(kind_ == GestureKind::SWIPE);
-  return *boost::any_cast<SwipeData>(&data_);
+  return boost::get<SwipeData>(data_);
 }
 
 inline const GestureEvent::PanData& GestureEvent::pan() const {
   assert(kind_ == GestureKind::PAN);
-  return *boost::any_cast<PanData>(&data_);
+  return boost::get<PanData>(data_);
 }
 
 inline const GestureEvent::ScreenEdgeData& GestureEvent::screen_edge() const {
   assert(kind_ == GestureKind::SCREEN_EDGE);
-  return *boost::any_cast<ScreenEdgeData>(&data_);
+  return boost::get<ScreenEdgeData>(data_);
 }
 
 #pragma mark Stream
@@ -0,0 +1,494 @@
+//
+//  solas/gesture_recognizer.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_GESTURE_RECOGNIZER_H_
+#define SOLAS_GESTURE_RECOGNIZER_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+#include "solas/gesture_event.h"
+#include "solas/gesture_kind.h"
+#include "solas/payload_pool.h"
+#include "solas/screen_edge.h"
+#include "solas/swipe_direction.h"
+#include "solas/touch_event.h"
+#include "solas/touch_tracker.h"
+#include "takram/math.h"
+
+namespace solas {
+
+// Recognizes taps, pinches, rotations, swipes, pans and screen edge pans
+// from a stream of touch events, for platforms without gesture recognizers
+// of their own. Every kind is recognized simultaneously on each event in
+// time linear in the number of touches, and nothing is allocated once the
+// payload pool holds touch arrays. Taps are reported as soon as the touches
+// are lifted, with the number of taps counted so far.
+class GestureRecognizer final {
+ public:
+  using Clock = TouchEvent::Clock;
+
+ public:
+  GestureRecognizer();
+
+  // Disallow copy semantics
+  GestureRecognizer(const GestureRecognizer&) = delete;
+  GestureRecognizer& operator=(const GestureRecognizer&) = delete;
+
+  // Properties
+  const takram::Size2d& bounds() const { return bounds_; }
+  void set_bounds(const takram::Size2d& value) { bounds_ = value; }
+  double tap_distance() const { return tap_distance_; }
+  void set_tap_distance(double value) { tap_distance_ = value; }
+  double tap_duration() const { return tap_duration_; }
+  void set_tap_duration(double value) { tap_duration_ = value; }
+  double tap_interval() const { return tap_interval_; }
+  void set_tap_interval(double value) { tap_interval_ = value; }
+  double pan_distance() const { return pan_distance_; }
+  void set_pan_distance(double value) { pan_distance_ = value; }
+  double pinch_threshold() const { return pinch_threshold_; }
+  void set_pinch_threshold(double value) { pinch_threshold_ = value; }
+  double rotation_threshold() const { return rotation_threshold_; }
+  void set_rotation_threshold(double value) { rotation_threshold_ = value; }
+  double swipe_distance() const { return swipe_distance_; }
+  void set_swipe_distance(double value) { swipe_distance_ = value; }
+  double swipe_duration() const { return swipe_duration_; }
+  void set_swipe_duration(double value) { swipe_duration_ = value; }
+  double edge_margin() const { return edge_margin_; }
+  void set_edge_margin(double value) { edge_margin_ = value; }
+
+  // Recognition
+  template <class Callback>
+  void recognize(const TouchEvent& event, Callback&& callback);
+  void reset();
+
+ private:
+  struct Sample {
+    std::size_t touches;
+    takram::Vec2d centroid;
+    double spread;
+    double angle;
+    TouchTracker::Identifier first;
+    TouchTracker::Identifier second;
+  };
+
+  Sample measure() const;
+  void begin(const Sample& sample, Clock::time_point time);
+  void rebase(const Sample& sample);
+  void advance(const Sample& sample, Clock::time_point time);
+  ScreenEdge edge(const takram::Vec2d& location) const;
+  double distanceFromEdge() const;
+  template <class Data, class Callback>
+  void emit(GestureEvent::Type type,
+            GestureKind kind,
+            const Data& data,
+            Clock::time_point time,
+            Callback&& callback) const;
+
+ private:
+  TouchTracker tracker_;
+
+  // Properties
+  takram::Size2d bounds_;
+  double tap_distance_;
+  double tap_duration_;
+  double tap_interval_;
+  double pan_distance_;
+  double pinch_threshold_;
+  double rotation_threshold_;
+  double swipe_distance_;
+  double swipe_duration_;
+  double edge_margin_;
+
+  // Touches down
+  bool active_;
+  Clock::time_point began_time_;
+  Clock::time_point time_;
+  std::size_t max_touches_;
+  bool moved_;
+  ScreenEdge edge_;
+  Sample origin_;
+  Sample last_;
+
+  // Transforms accumulated over changes of the touches
+  takram::Vec2d translation_base_;
+  double scale_base_;
+  double rotation_base_;
+  takram::Vec2d translation_;
+  double scale_;
+  double rotation_;
+  takram::Vec2d pan_velocity_;
+  double pinch_velocity_;
+  double rotation_velocity_;
+
+  // Recognized gestures
+  bool panning_;
+  bool pinching_;
+  bool rotating_;
+  bool swiped_;
+  bool edge_panning_;
+
+  // Taps
+  Clock::time_point tap_time_;
+  takram::Vec2d tap_location_;
+  std::size_t taps_;
+  std::size_t tap_touches_;
+};
+
+#pragma mark -
+
+inline GestureRecognizer::GestureRecognizer()
+    : tap_distance_(10.0),
+      tap_duration_(0.5),
+      tap_interval_(0.3),
+      pan_distance_(10.0),
+      pinch_threshold_(0.05),
+      rotation_threshold_(0.1),
+      swipe_distance_(50.0),
+      swipe_duration_(0.5),
+      edge_margin_(20.0) {
+  reset();
+}
+
+#pragma mark Recognition
+
+template <class Callback>
+inline void GestureRecognizer::recognize(const TouchEvent& event,
+                                         Callback&& callback) {
+  tracker_.advance();
+  tracker_.update(event);
+  const auto time = event.timestamp();
+  const auto sample = measure();
+  if (!active_) {
+    if (!sample.touches) {
+      return;
+    }
+    begin(sample, time);
+  }
+  if (sample.touches != last_.touches ||
+      sample.first != last_.first ||
+      sample.second != last_.second) {
+    rebase(sample);
+  }
+  if (sample.touches) {
+    advance(sample, time);
+  }
+  const auto cancelled = event.type() == TouchEvent::Type::CANCELLED;
+  const auto ended = cancelled || !sample.touches;
+  const auto last = (cancelled ? GestureEvent::Type::CANCELLED
+                               : GestureEvent::Type::ENDED);
+  const auto elapsed = std::chrono::duration<double>(
+      time - began_time_).count();
+
+  // Pans and screen edge pans
+  if (panning_) {
+    emit(ended ? last : GestureEvent::Type::CHANGED,
+         GestureKind::PAN,
+         GestureEvent::PanData{translation_, pan_velocity_, last_.touches},
+         time, callback);
+  } else if (!ended && std::hypot(translation_.x, translation_.y) >
+                           pan_distance_) {
+    panning_ = true;
+    emit(GestureEvent::Type::BEGAN, GestureKind::PAN,
+         GestureEvent::PanData{translation_, pan_velocity_, last_.touches},
+         time, callback);
+  }
+  if (edge_panning_) {
+    emit(ended ? last : GestureEvent::Type::CHANGED,
+         GestureKind::SCREEN_EDGE, GestureEvent::ScreenEdgeData{edge_},
+         time, callback);
+  } else if (!ended && edge_ != ScreenEdge::UNDEFINED &&
+             distanceFromEdge() > pan_distance_) {
+    edge_panning_ = true;
+    emit(GestureEvent::Type::BEGAN, GestureKind::SCREEN_EDGE,
+         GestureEvent::ScreenEdgeData{edge_}, time, callback);
+  }
+
+  // Pinches and rotations, which need two touches or more
+  const auto paired = !ended && sample.touches >= 2;
+  if (pinching_) {
+    emit(paired ? GestureEvent::Type::CHANGED : last,
+         GestureKind::PINCH,
+         GestureEvent::PinchData{scale_, pinch_velocity_}, time, callback);
+    pinching_ = paired;
+  } else if (paired && std::abs(scale_ - 1.0) > pinch_threshold_) {
+    pinching_ = true;
+    emit(GestureEvent::Type::BEGAN, GestureKind::PINCH,
+         GestureEvent::PinchData{scale_, pinch_velocity_}, time, callback);
+  }
+  if (rotating_) {
+    emit(paired ? GestureEvent::Type::CHANGED : last,
+         GestureKind::ROTATION,
+         GestureEvent::RotationData{rotation_, rotation_velocity_},
+         time, callback);
+    rotating_ = paired;
+  } else if (paired && std::abs(rotation_) > rotation_threshold_) {
+    rotating_ = true;
+    emit(GestureEvent::Type::BEGAN, GestureKind::ROTATION,
+         GestureEvent::RotationData{rotation_, rotation_velocity_},
+         time, callback);
+  }
+
+  // Swipes are recognized once they travel far enough in time
+  if (!swiped_ && !cancelled && elapsed <= swipe_duration_) {
+    const auto dx = std::abs(translation_.x);
+    const auto dy = std::abs(translation_.y);
+    if (std::max(dx, dy) >= swipe_distance_ &&
+        std::max(dx, dy) >= 2.0 * std::min(dx, dy)) {
+      swiped_ = true;
+      SwipeDirection direction;
+      if (dx > dy) {
+        direction = (translation_.x > 0.0 ? SwipeDirection::RIGHT
+                                          : SwipeDirection::LEFT);
+      } else {
+        direction = (translation_.y > 0.0 ? SwipeDirection::PRESSED
+                                          : SwipeDirection::RELEASED);
+      }
+      emit(GestureEvent::Type::ENDED, GestureKind::SWIPE,
+           GestureEvent::SwipeData{direction, max_touches_}, time, callback);
+    }
+  }
+  if (!ended) {
+    return;
+  }
+
+  // Taps are recognized when the touches are lifted without moving
+  if (!cancelled && !moved_ && elapsed <= tap_duration_) {
+    const auto interval = std::chrono::duration<double>(
+        time - tap_time_).count();
+    const auto distance = std::hypot(last_.centroid.x - tap_location_.x,
+                                     last_.centroid.y - tap_location_.y);
+    if (taps_ && interval <= tap_interval_ &&
+        distance <= 4.0 * tap_distance_ && tap_touches_ == max_touches_) {
+      ++taps_;
+    } else {
+      taps_ = 1;
+    }
+    tap_time_ = time;
+    tap_location_ = last_.centroid;
+    tap_touches_ = max_touches_;
+    emit(GestureEvent::Type::ENDED, GestureKind::TAP,
+         GestureEvent::TapData{taps_, tap_touches_}, time, callback);
+  } else {
+    taps_ = 0;
+  }
+  active_ = false;
+  panning_ = false;
+  pinching_ = false;
+  rotating_ = false;
+  edge_panning_ = false;
+}
+
+inline void GestureRecognizer::reset() {
+  tracker_.reset();
+  active_ = false;
+  max_touches_ = 0;
+  moved_ = false;
+  edge_ = ScreenEdge::UNDEFINED;
+  origin_ = Sample();
+  last_ = Sample();
+  panning_ = false;
+  pinching_ = false;
+  rotating_ = false;
+  swiped_ = false;
+  edge_panning_ = false;
+  tap_time_ = Clock::time_point();
+  taps_ = 0;
+  tap_touches_ = 0;
+}
+
+inline GestureRecognizer::Sample GestureRecognizer::measure() const {
+  // Touches that ended in this event no longer count
+  Sample sample = Sample();
+  const auto positions = tracker_.positions();
+  const auto phases = tracker_.phases();
+  const auto identifiers = tracker_.identifiers();
+  double x = 0.0;
+  double y = 0.0;
+  std::size_t pair[2] = {};
+  for (std::size_t i = 0; i < tracker_.size(); ++i) {
+    if (phases[i] == TouchEvent::Type::ENDED ||
+        phases[i] == TouchEvent::Type::CANCELLED) {
+      continue;
+    }
+    if (sample.touches < 2) {
+      pair[sample.touches] = i;
+    }
+    x += positions[i].x;
+    y += positions[i].y;
+    ++sample.touches;
+  }
+  if (!sample.touches) {
+    return sample;
+  }
+  sample.centroid = takram::Vec2d(x / sample.touches, y / sample.touches);
+  double spread = 0.0;
+  for (std::size_t i = 0; i < tracker_.size(); ++i) {
+    if (phases[i] != TouchEvent::Type::ENDED &&
+        phases[i] != TouchEvent::Type::CANCELLED) {
+      spread += std::hypot(positions[i].x - sample.centroid.x,
+                           positions[i].y - sample.centroid.y);
+    }
+  }
+  sample.spread = spread / sample.touches;
+  if (sample.touches >= 2) {
+    const auto& first = positions[pair[0]];
+    const auto& second = positions[pair[1]];
+    sample.angle = std::atan2(second.y - first.y, second.x - first.x);
+    sample.first = identifiers[pair[0]];
+    sample.second = identifiers[pair[1]];
+  }
+  return sample;
+}
+
+inline void GestureRecognizer::begin(const Sample& sample,
+                                     Clock::time_point time) {
+  active_ = true;
+  began_time_ = time;
+  time_ = time;
+  max_touches_ = sample.touches;
+  moved_ = false;
+  edge_ = edge(sample.centroid);
+  origin_ = sample;
+  last_ = sample;
+  translation_base_ = takram::Vec2d();
+  scale_base_ = 1.0;
+  rotation_base_ = 0.0;
+  translation_ = takram::Vec2d();
+  scale_ = 1.0;
+  rotation_ = 0.0;
+  pan_velocity_ = takram::Vec2d();
+  pinch_velocity_ = 0.0;
+  rotation_velocity_ = 0.0;
+  swiped_ = false;
+}
+
+inline void GestureRecognizer::rebase(const Sample& sample) {
+  // Keep the transforms so far when touches are added or removed, so that
+  // they continue from there without jumping.
+  translation_base_ = translation_;
+  scale_base_ = scale_;
+  rotation_base_ = rotation_;
+  if (sample.touches) {
+    origin_ = sample;
+    last_ = sample;
+  } else {
+    last_.touches = 0;
+  }
+}
+
+inline void GestureRecognizer::advance(const Sample& sample,
+                                       Clock::time_point time) {
+  const auto translation = takram::Vec2d(
+      translation_base_.x + sample.centroid.x - origin_.centroid.x,
+      translation_base_.y + sample.centroid.y - origin_.centroid.y);
+  auto scale = scale_base_;
+  auto rotation = rotation_base_;
+  if (sample.touches >= 2 && origin_.spread > 0.0) {
+    scale *= sample.spread / origin_.spread;
+    auto angle = sample.angle - origin_.angle;
+    if (angle > M_PI) {
+      angle -= 2.0 * M_PI;
+    } else if (angle < -M_PI) {
+      angle += 2.0 * M_PI;
+    }
+    rotation += angle;
+  }
+  const auto interval = std::chrono::duration<double>(time - time_).count();
+  if (interval > 0.0) {
+    // Smooth the velocities over the latest samples
+    pan_velocity_ = takram::Vec2d(
+        (pan_velocity_.x + (translation.x - translation_.x) / interval) / 2.0,
+        (pan_velocity_.y + (translation.y - translation_.y) / interval) / 2.0);
+    pinch_velocity_ = (pinch_velocity_ + (scale - scale_) / interval) / 2.0;
+    rotation_velocity_ = (rotation_velocity_ +
+                          (rotation - rotation_) / interval) / 2.0;
+  }
+  translation_ = translation;
+  scale_ = scale;
+  rotation_ = rotation;
+  time_ = time;
+  last_ = sample;
+  max_touches_ = std::max(max_touches_, sample.touches);
+  if (std::hypot(translation_.x, translation_.y) > tap_distance_) {
+    moved_ = true;
+  }
+}
+
+inline ScreenEdge GestureRecognizer::edge(
+    const takram::Vec2d& location) const {
+  if (bounds_.width <= 0.0 || bounds_.height <= 0.0) {
+    return ScreenEdge::UNDEFINED;
+  }
+  if (location.x < edge_margin_) {
+    return ScreenEdge::LEFT;
+  } else if (location.x > bounds_.width - edge_margin_) {
+    return ScreenEdge::RIGHT;
+  } else if (location.y < edge_margin_) {
+    return ScreenEdge::TOP;
+  } else if (location.y > bounds_.height - edge_margin_) {
+    return ScreenEdge::BOTTOM;
+  }
+  return ScreenEdge::UNDEFINED;
+}
+
+inline double GestureRecognizer::distanceFromEdge() const {
+  switch (edge_) {
+    case ScreenEdge::LEFT:
+      return translation_.x;
+    case ScreenEdge::RIGHT:
+      return -translation_.x;
+    case ScreenEdge::TOP:
+      return translation_.y;
+    case ScreenEdge::BOTTOM:
+      return -translation_.y;
+    default:
+      break;
+  }
+  return 0.0;
+}
+
+template <class Data, class Callback>
+inline void GestureRecognizer::emit(GestureEvent::Type type,
+                                    GestureKind kind,
+                                    const Data& data,
+                                    Clock::time_point time,
+                                    Callback&& callback) const {
+  auto touches = PayloadPool::shared().touches();
+  const auto positions = tracker_.positions();
+  touches.assign(positions.begin(), positions.end());
+  GestureEvent event(type, kind, std::move(touches), data);
+  event.set_timestamp(time);
+  callback(std::move(event));
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_GESTURE_RECOGNIZER_H_
@@ -28,8 +28,6 @@
 #ifndef SOLAS_GROUP_H_
 #define SOLAS_GROUP_H_
 
-#include <cassert>
-
 #include "solas/composite.h"
 
 namespace solas {
@@ -64,13 +62,7 @@ inline Group<View>::Group(Group *parent) : Composite(parent) {}
 
 template <class View>
 inline View& Group<View>::view() const {
-  Composite *current = parent();
-  assert(current);
-  while (current->parent()) {
-    current = current->parent();
-  }
-  assert(current);
-  return static_cast<View&>(*current);
+  return static_cast<View&>(*root());
 }
 
 }  // namespace solas
@@ -0,0 +1,88 @@
+//
+//  solas/headless_context.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_HEADLESS_CONTEXT_H_
+#define SOLAS_HEADLESS_CONTEXT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace solas {
+
+class HeadlessContext final {
+ public:
+  HeadlessContext();
+
+  // Disallow copy semantics
+  HeadlessContext(const HeadlessContext&) = delete;
+  HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+  // Properties
+  std::int32_t width() const { return width_; }
+  std::int32_t height() const { return height_; }
+  std::uint32_t * data() { return pixels_.data(); }
+  const std::uint32_t * data() const { return pixels_.data(); }
+  std::size_t size() const { return pixels_.size(); }
+
+  // Using the context
+  void update(std::int32_t width, std::int32_t height, double scale = 1.0);
+  void clear(std::uint32_t color = 0xffffffff);
+
+ private:
+  std::int32_t width_;
+  std::int32_t height_;
+  std::vector<std::uint32_t> pixels_;
+};
+
+#pragma mark -
+
+inline HeadlessContext::HeadlessContext() : width_(), height_() {}
+
+#pragma mark Using the context
+
+inline void HeadlessContext::update(std::int32_t width,
+                                    std::int32_t height,
+                                    double scale) {
+  width *= scale;
+  height *= scale;
+  if (width == width_ && height == height_) {
+    return;
+  }
+  width_ = std::max(width, std::int32_t());
+  height_ = std::max(height, std::int32_t());
+  pixels_.resize(static_cast<std::size_t>(width_) * height_);
+}
+
+inline void HeadlessContext::clear(std::uint32_t color) {
+  std::fill(pixels_.begin(), pixels_.end(), color);
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_HEADLESS_CONTEXT_H_
@@ -0,0 +1,216 @@
+//
+//  solas/headless_run_loop.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/headless_run_loop.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "solas/app_event.h"
+#include "solas/headless_context.h"
+#include "solas/run.h"
+#include "solas/runner.h"
+#include "solas/runner_scheduler.h"
+#include "takram/math.h"
+
+namespace solas {
+
+namespace {
+
+const takram::Size2d default_size(640.0, 480.0);
+const double default_frame_rate = 60.0;
+
+}  // namespace
+
+HeadlessRunLoop::HeadlessRunLoop()
+    : HeadlessRunLoop(Run::instance().create()) {}
+
+HeadlessRunLoop::HeadlessRunLoop(std::unique_ptr<Runner>&& runner)
+    : runner_(std::move(runner)),
+      size_(default_size),
+      scale_(1.0),
+      pacer_(default_frame_rate),
+      full_screen_(false),
+      running_(false),
+      frames_(),
+      elapsed_() {
+  assert(runner_);
+  runner_->set_delegate(this);
+  context_.update(size_.width, size_.height, scale_);
+}
+
+HeadlessRunLoop::~HeadlessRunLoop() {
+  if (runner_) {
+    runner_->set_delegate(nullptr);
+    runner_.reset();
+  }
+}
+
+#pragma mark Running the loop
+
+void HeadlessRunLoop::run() {
+  run(std::size_t());
+}
+
+void HeadlessRunLoop::run(std::size_t frames) {
+  running_ = true;
+  const auto start = Clock::now();
+  pacer_.reset(start);
+  for (std::size_t frame = 0; running_ && (!frames || frame < frames);
+       ++frame) {
+    step();
+    pacer_.wait();
+  }
+  elapsed_ += Clock::now() - start;
+  running_ = false;
+}
+
+void HeadlessRunLoop::step() {
+  const AppEvent update(AppEvent::Type::UPDATE, context_, size_, scale_);
+  runner_->update(update);
+  const AppEvent draw(AppEvent::Type::DRAW, context_, size_, scale_);
+  runner_->draw(draw);
+  ++frames_;
+}
+
+void HeadlessRunLoop::stop() {
+  running_ = false;
+}
+
+#pragma mark Running multiple loops
+
+void HeadlessRunLoop::run(const std::vector<HeadlessRunLoop *>& loops,
+                          std::size_t frames,
+                          RunnerScheduler& scheduler) {
+  if (loops.empty()) {
+    return;
+  }
+  // Every loop steps at its own frame rate, and the loops that are due at
+  // the same time step together on workers of the scheduler. In between,
+  // the caller sleeps until the earliest deadline of the loops, unless any
+  // of them is uncapped.
+  std::vector<std::size_t> counts(loops.size());
+  std::vector<HeadlessRunLoop *> due;
+  due.reserve(loops.size());
+  const auto start = Clock::now();
+  for (const auto loop : loops) {
+    loop->running_ = true;
+    loop->pacer_.reset(start);
+  }
+  HeadlessRunLoop *woken = nullptr;
+  for (bool first = true;; first = false) {
+    const auto running = std::all_of(
+        loops.begin(), loops.end(), [](const HeadlessRunLoop *loop) {
+          return loop->running_.load();
+        });
+    if (!running) {
+      break;
+    }
+    const auto now = Clock::now();
+    due.clear();
+    for (std::size_t i = 0; i < loops.size(); ++i) {
+      const auto loop = loops[i];
+      if (frames && counts[i] == frames) {
+        continue;
+      }
+      if (first || loop == woken || loop->pacer_.poll(now)) {
+        due.push_back(loop);
+        ++counts[i];
+      }
+    }
+    scheduler.apply(due.begin(), due.end(), [](HeadlessRunLoop *loop) {
+      loop->step();
+    });
+    woken = nullptr;
+    bool finished = true;
+    bool uncapped = false;
+    for (std::size_t i = 0; i < loops.size(); ++i) {
+      const auto loop = loops[i];
+      if (frames && counts[i] == frames) {
+        continue;
+      }
+      finished = false;
+      if (loop->frame_rate() <= 0.0) {
+        uncapped = true;
+      } else if (!woken ||
+                 loop->pacer_.deadline() < woken->pacer_.deadline()) {
+        woken = loop;
+      }
+    }
+    if (finished) {
+      break;
+    }
+    if (uncapped) {
+      woken = nullptr;
+    } else {
+      woken->pacer_.wait();
+    }
+  }
+  const auto elapsed = Clock::now() - start;
+  for (const auto loop : loops) {
+    loop->elapsed_ += elapsed;
+    loop->running_ = false;
+  }
+}
+
+#pragma mark Environment
+
+void HeadlessRunLoop::frameRate(double fps) {
+  pacer_.set_frame_rate(fps);
+}
+
+void HeadlessRunLoop::resize(const takram::Size2d& size) {
+  size_ = size;
+  context_.update(size_.width, size_.height, scale_);
+}
+
+void HeadlessRunLoop::fullScreen(bool flag) {
+  full_screen_ = flag;
+}
+
+#pragma mark Properties
+
+void HeadlessRunLoop::set_scale(double value) {
+  scale_ = value;
+  context_.update(size_.width, size_.height, scale_);
+}
+
+#pragma mark Statistics
+
+double HeadlessRunLoop::throughput() const {
+  const auto seconds = std::chrono::duration<double>(elapsed_).count();
+  if (seconds <= 0.0) {
+    return 0.0;
+  }
+  return frames_ / seconds;
+}
+
+}  // namespace solas
@@ -0,0 +1,106 @@
+//
+//  solas/headless_run_loop.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_HEADLESS_RUN_LOOP_H_
+#define SOLAS_HEADLESS_RUN_LOOP_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "solas/frame_pacer.h"
+#include "solas/headless_context.h"
+#include "solas/runner.h"
+#include "solas/runner_delegate.h"
+#include "solas/runner_scheduler.h"
+#include "takram/math.h"
+
+namespace solas {
+
+class HeadlessRunLoop final : public RunnerDelegate {
+ public:
+  using Clock = FramePacer::Clock;
+
+ public:
+  HeadlessRunLoop();
+  explicit HeadlessRunLoop(std::unique_ptr<Runner>&& runner);
+  ~HeadlessRunLoop();
+
+  // Disallow copy semantics
+  HeadlessRunLoop(const HeadlessRunLoop&) = delete;
+  HeadlessRunLoop& operator=(const HeadlessRunLoop&) = delete;
+
+  // Running the loop
+  void run();
+  void run(std::size_t frames);
+  void step();
+  void stop();
+  bool running() const { return running_; }
+
+  // Running multiple loops
+  static void run(const std::vector<HeadlessRunLoop *>& loops,
+                  std::size_t frames,
+                  RunnerScheduler& scheduler = RunnerScheduler::shared());
+
+  // Environment
+  void frameRate(double fps) override;
+  void resize(const takram::Size2d& size) override;
+  void fullScreen(bool flag) override;
+
+  // Properties
+  Runner * runner() const { return runner_.get(); }
+  const HeadlessContext& context() const { return context_; }
+  const takram::Size2d& size() const { return size_; }
+  double scale() const { return scale_; }
+  void set_scale(double value);
+  double frame_rate() const { return pacer_.frame_rate(); }
+  void set_frame_rate(double value) { pacer_.set_frame_rate(value); }
+  bool full_screen() const { return full_screen_; }
+
+  // Statistics
+  std::size_t frames() const { return frames_; }
+  Clock::duration elapsed() const { return elapsed_; }
+  double throughput() const;
+  const FramePacer& pacer() const { return pacer_; }
+
+ private:
+  std::unique_ptr<Runner> runner_;
+  HeadlessContext context_;
+  takram::Size2d size_;
+  double scale_;
+  FramePacer pacer_;
+  bool full_screen_;
+  std::atomic_bool running_;
+  std::size_t frames_;
+  Clock::duration elapsed_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_HEADLESS_RUN_LOOP_H_
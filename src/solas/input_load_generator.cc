@@ -0,0 +1,423 @@
+//
+//  solas/input_load_generator.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/input_load_generator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "solas/allocation_counter.h"
+#include "solas/app_event.h"
+#include "solas/gesture_event.h"
+#include "solas/gesture_kind.h"
+#include "solas/key_event.h"
+#include "solas/key_modifier.h"
+#include "solas/mouse_button.h"
+#include "solas/mouse_event.h"
+#include "solas/payload_pool.h"
+#include "solas/runner.h"
+#include "solas/touch_event.h"
+#include "takram/math.h"
+
+namespace solas {
+
+namespace {
+
+// Number of changes in a gesture sequence between its beginning and end
+constexpr std::size_t gesture_changes = 30;
+
+// Seconds between presses and releases of the mouse on its path
+constexpr double mouse_toggle_interval = 0.5;
+
+template <class Duration>
+inline InputLoadGenerator::Clock::duration duration(Duration value) {
+  return std::chrono::duration_cast<InputLoadGenerator::Clock::duration>(
+      value);
+}
+
+inline InputLoadGenerator::Clock::time_point timestamp(
+    InputLoadGenerator::Clock::time_point now,
+    double interval,
+    std::size_t index,
+    std::size_t count) {
+  // Spread events evenly over the interval that ends now
+  const auto offset = interval * (count - index - 1) / count;
+  return now - duration(std::chrono::duration<double>(offset));
+}
+
+}  // namespace
+
+#pragma mark InputLoadReport
+
+double InputLoadReport::events_per_second() const {
+  return duration > 0.0 ? events / duration : 0.0;
+}
+
+double InputLoadReport::allocations_per_frame() const {
+  return frames ? static_cast<double>(allocations) / frames : 0.0;
+}
+
+#pragma mark -
+
+InputLoadGenerator::InputLoadGenerator(const InputLoadOptions& options)
+    : options_(options) {
+  reset();
+}
+
+void InputLoadGenerator::reset() {
+  report_ = InputLoadReport();
+  random_.seed(options_.seed());
+  time_ = 0.0;
+  poll_time_ = Clock::time_point();
+  dispatch_duration_ = Clock::duration::zero();
+  mouse_remainder_ = 0.0;
+  mouse_toggle_ = mouse_toggle_interval;
+  mouse_pressed_ = false;
+  touch_remainder_ = 0.0;
+  touches_.clear();
+  touch_identifier_ = 0;
+  key_remainder_ = 0.0;
+  key_index_ = 0;
+  gesture_remainder_ = 0.0;
+  gesture_kind_ = GestureKind::PAN;
+  gesture_step_ = 0;
+}
+
+#pragma mark Polling events
+
+void InputLoadGenerator::poll(Runner& runner) {
+  const auto now = Clock::now();
+  double interval = 1.0 / 60.0;
+  if (options_.frame_rate() > 0.0) {
+    interval = 1.0 / options_.frame_rate();
+  } else if (poll_time_ != Clock::time_point()) {
+    interval = std::chrono::duration<double>(now - poll_time_).count();
+  }
+  poll_time_ = now;
+  generateMouse(runner, interval, now);
+  generateTouches(runner, interval, now);
+  generateKeys(runner, interval, now);
+  generateGestures(runner, interval, now);
+  time_ += interval;
+  dispatch_duration_ = Clock::now() - now;
+  report_.dispatch.record(dispatch_duration_);
+}
+
+#pragma mark Running
+
+const InputLoadReport& InputLoadGenerator::run(Runner& runner,
+                                               std::size_t frames) {
+  report_ = InputLoadReport();
+  report_.counts_allocations = AllocationCounter::installed();
+  const AppEvent event(AppEvent::Type::DRAW, nullptr, options_.size(), 1.0);
+  runner.addInputSource(this);
+  const auto allocations = AllocationCounter::count();
+  const auto start = Clock::now();
+  for (std::size_t frame = 0; frame < frames; ++frame) {
+    const auto begin = Clock::now();
+    dispatch_duration_ = Clock::duration::zero();
+    runner.draw(event);
+    report_.drain.record(Clock::now() - begin - dispatch_duration_);
+    ++report_.frames;
+  }
+  report_.duration = std::chrono::duration<double>(
+      Clock::now() - start).count();
+  report_.allocations = AllocationCounter::count() - allocations;
+  runner.removeInputSource(this);
+  return report_;
+}
+
+#pragma mark Generating events
+
+std::size_t InputLoadGenerator::count(double rate,
+                                      double interval,
+                                      double *remainder) {
+  if (rate <= 0.0) {
+    return 0;
+  }
+  *remainder += rate * interval;
+  const auto result = std::floor(*remainder);
+  *remainder -= result;
+  return static_cast<std::size_t>(result);
+}
+
+void InputLoadGenerator::generateMouse(Runner& runner,
+                                       double interval,
+                                       Clock::time_point now) {
+  const auto events = count(options_.mouse_rate(), interval,
+                            &mouse_remainder_);
+  const auto& size = options_.size();
+  std::normal_distribution<double> jitter(0.0, 0.5);
+  for (std::size_t i = 0; i < events; ++i) {
+    // Follow a Lissajous curve with a little noise, pressing and releasing
+    // the button at intervals.
+    const auto time = time_ + interval * (i + 1) / events;
+    const takram::Vec2d location(
+        size.width * (0.5 + 0.4 * std::sin(2.0 * M_PI * 0.7 * time)) +
+            jitter(random_),
+        size.height * (0.5 + 0.4 * std::sin(2.0 * M_PI * 1.1 * time + 0.5)) +
+            jitter(random_));
+    auto type = (mouse_pressed_ ? MouseEvent::Type::DRAGGED
+                                : MouseEvent::Type::MOVED);
+    if (time >= mouse_toggle_) {
+      mouse_toggle_ += mouse_toggle_interval;
+      mouse_pressed_ = !mouse_pressed_;
+      type = (mouse_pressed_ ? MouseEvent::Type::PRESSED
+                             : MouseEvent::Type::RELEASED);
+    }
+    MouseEvent event(type,
+                     location,
+                     (type == MouseEvent::Type::MOVED ? MouseButton::UNDEFINED
+                                                      : MouseButton::LEFT),
+                     KeyModifier::NONE);
+    event.set_timestamp(timestamp(now, interval, i, events));
+    switch (type) {
+      case MouseEvent::Type::PRESSED:
+        runner.mousePressed(event);
+        break;
+      case MouseEvent::Type::DRAGGED:
+        runner.mouseDragged(event);
+        break;
+      case MouseEvent::Type::RELEASED:
+        runner.mouseReleased(event);
+        break;
+      default:
+        runner.mouseMoved(event);
+        break;
+    }
+  }
+  report_.events += events;
+}
+
+void InputLoadGenerator::generateTouches(Runner& runner,
+                                         double interval,
+                                         Clock::time_point now) {
+  const auto events = count(options_.touch_rate(), interval,
+                            &touch_remainder_);
+  for (std::size_t i = 0; i < events; ++i) {
+    const auto time = time_ + interval * (i + 1) / events;
+    const auto stamp = timestamp(now, interval, i, events);
+
+    // Touches end after their lifetime and others begin in their place, each
+    // in an event of its own.
+    for (auto& touch : touches_) {
+      if (time < touch.end) {
+        continue;
+      }
+      auto touches = PayloadPool::shared().touches();
+      auto contacts = PayloadPool::shared().contacts();
+      touches.emplace_back(location(touch, time));
+      contacts.push_back({touch.identifier, TouchEvent::Type::ENDED});
+      TouchEvent ended(TouchEvent::Type::ENDED,
+                       std::move(touches),
+                       std::move(contacts));
+      ended.set_timestamp(stamp);
+      runner.touchesEnded(std::move(ended));
+      touch = makeTouch(time);
+      touches = PayloadPool::shared().touches();
+      contacts = PayloadPool::shared().contacts();
+      touches.emplace_back(location(touch, time));
+      contacts.push_back({touch.identifier, TouchEvent::Type::BEGAN});
+      TouchEvent began(TouchEvent::Type::BEGAN,
+                       std::move(touches),
+                       std::move(contacts));
+      began.set_timestamp(stamp);
+      runner.touchesBegan(std::move(began));
+      report_.events += 2;
+    }
+    if (touches_.size() < options_.touch_count()) {
+      auto touches = PayloadPool::shared().touches();
+      auto contacts = PayloadPool::shared().contacts();
+      while (touches_.size() < options_.touch_count()) {
+        touches_.emplace_back(makeTouch(time));
+        touches.emplace_back(location(touches_.back(), time));
+        contacts.push_back({
+          touches_.back().identifier,
+          TouchEvent::Type::BEGAN
+        });
+      }
+      TouchEvent began(TouchEvent::Type::BEGAN,
+                       std::move(touches),
+                       std::move(contacts));
+      began.set_timestamp(stamp);
+      runner.touchesBegan(std::move(began));
+      ++report_.events;
+    }
+    auto touches = PayloadPool::shared().touches();
+    auto contacts = PayloadPool::shared().contacts();
+    for (const auto& touch : touches_) {
+      touches.emplace_back(location(touch, time));
+      contacts.push_back({touch.identifier, TouchEvent::Type::MOVED});
+    }
+    TouchEvent moved(TouchEvent::Type::MOVED,
+                     std::move(touches),
+                     std::move(contacts));
+    moved.set_timestamp(stamp);
+    runner.touchesMoved(std::move(moved));
+  }
+  report_.events += events;
+}
+
+void InputLoadGenerator::generateKeys(Runner& runner,
+                                      double interval,
+                                      Clock::time_point now) {
+  // Keys are pressed in bursts of the given number at once, as in typing
+  // a word or repeating a key.
+  const auto burst = std::max<std::size_t>(options_.key_burst(), 1);
+  const auto bursts = count(options_.key_rate() / burst, interval,
+                            &key_remainder_);
+  const auto events = bursts * burst;
+  for (std::size_t i = 0; i < events; ++i, ++key_index_) {
+    const auto letter = key_index_ % 26;
+    const auto stamp = timestamp(now, interval, i, events);
+    for (const auto type : {KeyEvent::Type::PRESSED,
+                            KeyEvent::Type::RELEASED}) {
+      auto characters = PayloadPool::shared().characters();
+      characters.push_back(static_cast<char>('a' + letter));
+      KeyEvent event(type,
+                     static_cast<std::uint32_t>(letter + 4),
+                     std::move(characters),
+                     KeyModifier::NONE);
+      event.set_timestamp(stamp);
+      if (type == KeyEvent::Type::PRESSED) {
+        runner.keyPressed(std::move(event));
+      } else {
+        runner.keyReleased(std::move(event));
+      }
+    }
+  }
+  report_.events += events * 2;
+}
+
+void InputLoadGenerator::generateGestures(Runner& runner,
+                                          double interval,
+                                          Clock::time_point now) {
+  const auto events = count(options_.gesture_rate(), interval,
+                            &gesture_remainder_);
+  const auto& size = options_.size();
+  const takram::Vec2d center(size.width / 2.0, size.height / 2.0);
+  for (std::size_t i = 0; i < events; ++i) {
+    // Each sequence begins, changes a number of times and ends, and then the
+    // next kind of gesture follows.
+    auto type = GestureEvent::Type::CHANGED;
+    if (gesture_step_ == 0) {
+      type = GestureEvent::Type::BEGAN;
+    } else if (gesture_step_ == gesture_changes + 1) {
+      type = GestureEvent::Type::ENDED;
+    }
+    const auto progress = (static_cast<double>(gesture_step_) /
+                           (gesture_changes + 1));
+    const auto velocity = options_.gesture_rate() / (gesture_changes + 1);
+    const takram::Vec2d offset(100.0 * progress, 50.0 * progress);
+    auto touches = PayloadPool::shared().touches();
+    touches.emplace_back(center + offset);
+    if (gesture_kind_ != GestureKind::PAN) {
+      touches.emplace_back(center - offset);
+    }
+    auto event = [&]() {
+      switch (gesture_kind_) {
+        case GestureKind::PINCH:
+          return GestureEvent(type, gesture_kind_, std::move(touches),
+                              GestureEvent::PinchData{
+                                1.0 + progress,
+                                velocity
+                              });
+        case GestureKind::ROTATION:
+          return GestureEvent(type, gesture_kind_, std::move(touches),
+                              GestureEvent::RotationData{
+                                M_PI * progress,
+                                M_PI * velocity
+                              });
+        default:
+          return GestureEvent(type, gesture_kind_, std::move(touches),
+                              GestureEvent::PanData{
+                                offset,
+                                takram::Vec2d(100.0, 50.0) * velocity,
+                                1
+                              });
+      }
+    }();
+    event.set_timestamp(timestamp(now, interval, i, events));
+    switch (type) {
+      case GestureEvent::Type::BEGAN:
+        runner.gestureBegan(std::move(event));
+        break;
+      case GestureEvent::Type::ENDED:
+        runner.gestureEnded(std::move(event));
+        break;
+      default:
+        runner.gestureChanged(std::move(event));
+        break;
+    }
+    if (++gesture_step_ > gesture_changes + 1) {
+      gesture_step_ = 0;
+      switch (gesture_kind_) {
+        case GestureKind::PAN:
+          gesture_kind_ = GestureKind::PINCH;
+          break;
+        case GestureKind::PINCH:
+          gesture_kind_ = GestureKind::ROTATION;
+          break;
+        default:
+          gesture_kind_ = GestureKind::PAN;
+          break;
+      }
+    }
+  }
+  report_.events += events;
+}
+
+#pragma mark Touches
+
+InputLoadGenerator::Touch InputLoadGenerator::makeTouch(double time) {
+  // Touches circle around random points for half a second to three seconds
+  const auto& size = options_.size();
+  std::uniform_real_distribution<double> unit;
+  Touch touch;
+  touch.identifier = ++touch_identifier_;
+  touch.center = takram::Vec2d(size.width * unit(random_),
+                               size.height * unit(random_));
+  touch.radius = 10.0 + 40.0 * unit(random_);
+  touch.speed = 2.0 * M_PI * (0.2 + unit(random_));
+  touch.phase = 2.0 * M_PI * unit(random_);
+  touch.end = time + 0.5 + 2.5 * unit(random_);
+  return touch;
+}
+
+takram::Vec2d InputLoadGenerator::location(const Touch& touch,
+                                           double time) const {
+  const auto angle = touch.speed * time + touch.phase;
+  return touch.center + takram::Vec2d(touch.radius * std::cos(angle),
+                                      touch.radius * std::sin(angle));
+}
+
+}  // namespace solas
@@ -0,0 +1,141 @@
+//
+//  solas/input_load_generator.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_INPUT_LOAD_GENERATOR_H_
+#define SOLAS_INPUT_LOAD_GENERATOR_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "solas/gesture_kind.h"
+#include "solas/input_load_options.h"
+#include "solas/input_source.h"
+#include "solas/latency_histogram.h"
+#include "takram/math.h"
+
+namespace solas {
+
+class Runner;
+
+struct InputLoadReport {
+  std::size_t frames;
+  std::uint64_t events;
+
+  // Seconds of wall time that the run took
+  double duration;
+
+  // Time spent each frame generating events and passing them to the runner,
+  // and in the rest of drawing the frame where the runnable handles them
+  LatencyHistogram dispatch;
+  LatencyHistogram drain;
+
+  // Valid only when allocations are counted in the executable
+  bool counts_allocations;
+  std::uint64_t allocations;
+
+  double events_per_second() const;
+  double allocations_per_frame() const;
+};
+
+// Produces synthetic input at the rates of the options: mouse paths with
+// presses and drags, swarms of touches that come and go, bursts of key
+// presses, and sequences of pan, pinch and rotation gestures. As an input
+// source, it produces the events of the time since the last poll, or of a
+// frame of the given frame rate when it's not zero, with timestamps spread
+// over that time.
+class InputLoadGenerator final : public InputSource {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  explicit InputLoadGenerator(
+      const InputLoadOptions& options = InputLoadOptions());
+
+  // Polling events
+  void poll(Runner& runner) override;
+
+  // Drives the runner for the number of frames as fast as possible and
+  // measures it. The first frame of a runner includes its setup, which
+  // calling run once beforehand excludes from the report.
+  const InputLoadReport& run(Runner& runner, std::size_t frames);
+  void reset();
+
+  // Properties
+  const InputLoadOptions& options() const { return options_; }
+  const InputLoadReport& report() const { return report_; }
+
+ private:
+  struct Touch {
+    std::uintptr_t identifier;
+    takram::Vec2d center;
+    double radius;
+    double speed;
+    double phase;
+    double end;
+  };
+
+  // Generating events
+  static std::size_t count(double rate, double interval, double *remainder);
+  void generateMouse(Runner& runner, double interval, Clock::time_point now);
+  void generateTouches(Runner& runner,
+                       double interval,
+                       Clock::time_point now);
+  void generateKeys(Runner& runner, double interval, Clock::time_point now);
+  void generateGestures(Runner& runner,
+                        double interval,
+                        Clock::time_point now);
+
+  // Touches
+  Touch makeTouch(double time);
+  takram::Vec2d location(const Touch& touch, double time) const;
+
+ private:
+  InputLoadOptions options_;
+  InputLoadReport report_;
+  std::minstd_rand random_;
+  double time_;
+  Clock::time_point poll_time_;
+  Clock::duration dispatch_duration_;
+  double mouse_remainder_;
+  double mouse_toggle_;
+  bool mouse_pressed_;
+  double touch_remainder_;
+  std::vector<Touch> touches_;
+  std::uintptr_t touch_identifier_;
+  double key_remainder_;
+  std::size_t key_index_;
+  double gesture_remainder_;
+  GestureKind gesture_kind_;
+  std::size_t gesture_step_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_INPUT_LOAD_GENERATOR_H_
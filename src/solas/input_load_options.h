@@ -0,0 +1,143 @@
+//
+//  solas/input_load_options.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_INPUT_LOAD_OPTIONS_H_
+#define SOLAS_INPUT_LOAD_OPTIONS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "takram/math.h"
+
+namespace solas {
+
+// Rates in events per second of each kind of input that an input load
+// generator produces. Kinds of a rate of zero are not generated.
+class InputLoadOptions final {
+ public:
+  InputLoadOptions();
+
+  // Copy semantics
+  InputLoadOptions(const InputLoadOptions&) = default;
+  InputLoadOptions& operator=(const InputLoadOptions&) = default;
+
+  // Scenarios
+  static InputLoadOptions mousePath(double rate = 1000.0);
+  static InputLoadOptions touchSwarm(double rate = 240.0,
+                                     std::size_t touches = 10);
+  static InputLoadOptions keyBursts(double rate = 200.0,
+                                    std::size_t burst = 16);
+  static InputLoadOptions gestureSequences(double rate = 120.0);
+  static InputLoadOptions mixed();
+
+  // Properties
+  double mouse_rate() const { return mouse_rate_; }
+  void set_mouse_rate(double value) { mouse_rate_ = value; }
+  double touch_rate() const { return touch_rate_; }
+  void set_touch_rate(double value) { touch_rate_ = value; }
+  std::size_t touch_count() const { return touch_count_; }
+  void set_touch_count(std::size_t value) { touch_count_ = value; }
+  double key_rate() const { return key_rate_; }
+  void set_key_rate(double value) { key_rate_ = value; }
+  std::size_t key_burst() const { return key_burst_; }
+  void set_key_burst(std::size_t value) { key_burst_ = value; }
+  double gesture_rate() const { return gesture_rate_; }
+  void set_gesture_rate(double value) { gesture_rate_ = value; }
+  double frame_rate() const { return frame_rate_; }
+  void set_frame_rate(double value) { frame_rate_ = value; }
+  const takram::Size2d& size() const { return size_; }
+  void set_size(const takram::Size2d& value) { size_ = value; }
+  std::uint32_t seed() const { return seed_; }
+  void set_seed(std::uint32_t value) { seed_ = value; }
+
+ private:
+  double mouse_rate_;
+  double touch_rate_;
+  std::size_t touch_count_;
+  double key_rate_;
+  std::size_t key_burst_;
+  double gesture_rate_;
+  double frame_rate_;
+  takram::Size2d size_;
+  std::uint32_t seed_;
+};
+
+#pragma mark -
+
+inline InputLoadOptions::InputLoadOptions()
+    : mouse_rate_(),
+      touch_rate_(),
+      touch_count_(10),
+      key_rate_(),
+      key_burst_(16),
+      gesture_rate_(),
+      frame_rate_(60.0),
+      size_(1024.0, 768.0),
+      seed_(1) {}
+
+#pragma mark Scenarios
+
+inline InputLoadOptions InputLoadOptions::mousePath(double rate) {
+  InputLoadOptions options;
+  options.set_mouse_rate(rate);
+  return options;
+}
+
+inline InputLoadOptions InputLoadOptions::touchSwarm(double rate,
+                                                     std::size_t touches) {
+  InputLoadOptions options;
+  options.set_touch_rate(rate);
+  options.set_touch_count(touches);
+  return options;
+}
+
+inline InputLoadOptions InputLoadOptions::keyBursts(double rate,
+                                                    std::size_t burst) {
+  InputLoadOptions options;
+  options.set_key_rate(rate);
+  options.set_key_burst(burst);
+  return options;
+}
+
+inline InputLoadOptions InputLoadOptions::gestureSequences(double rate) {
+  InputLoadOptions options;
+  options.set_gesture_rate(rate);
+  return options;
+}
+
+inline InputLoadOptions InputLoadOptions::mixed() {
+  InputLoadOptions options;
+  options.set_mouse_rate(1000.0);
+  options.set_touch_rate(240.0);
+  options.set_key_rate(50.0);
+  options.set_gesture_rate(120.0);
+  return options;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_INPUT_LOAD_OPTIONS_H_
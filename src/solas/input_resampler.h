@@ -0,0 +1,219 @@
+//
+//  solas/input_resampler.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_INPUT_RESAMPLER_H_
+#define SOLAS_INPUT_RESAMPLER_H_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "takram/math.h"
+
+namespace solas {
+
+// Keeps a short history of timestamped positions of a pointer, and estimates
+// its position at another time. It interpolates between the samples around
+// the time, and extrapolates past the latest sample by no more than the
+// extrapolation limit or half the interval of the latest two samples.
+class InputResampler final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::size_t capacity = 16;
+
+ public:
+  InputResampler();
+
+  // Copy semantics
+  InputResampler(const InputResampler&) = default;
+  InputResampler& operator=(const InputResampler&) = default;
+
+  // Properties
+  double extrapolation_limit() const;
+  void set_extrapolation_limit(double value);
+  double velocity_window() const;
+  void set_velocity_window(double value);
+
+  // Samples
+  void add(Clock::time_point time, const takram::Vec2d& position);
+  void reset() { size_ = 0; }
+  bool empty() const { return !size_; }
+  std::size_t size() const { return size_; }
+
+  // Estimation
+  takram::Vec2d resample(Clock::time_point time) const;
+  takram::Vec2d velocity(Clock::time_point time) const;
+
+ private:
+  struct Sample {
+    Clock::time_point time;
+    takram::Vec2d position;
+  };
+
+  // The sample of the given age, where 0 is the latest
+  const Sample& sample(std::size_t age) const;
+
+ private:
+  std::array<Sample, capacity> samples_;
+  std::size_t head_;
+  std::size_t size_;
+  Clock::duration extrapolation_limit_;
+  Clock::duration velocity_window_;
+};
+
+#pragma mark -
+
+inline InputResampler::InputResampler()
+    : head_(),
+      size_(),
+      extrapolation_limit_(std::chrono::milliseconds(8)),
+      velocity_window_(std::chrono::milliseconds(100)) {}
+
+#pragma mark Properties
+
+inline double InputResampler::extrapolation_limit() const {
+  return std::chrono::duration<double>(extrapolation_limit_).count();
+}
+
+inline void InputResampler::set_extrapolation_limit(double value) {
+  extrapolation_limit_ = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(std::max(value, 0.0)));
+}
+
+inline double InputResampler::velocity_window() const {
+  return std::chrono::duration<double>(velocity_window_).count();
+}
+
+inline void InputResampler::set_velocity_window(double value) {
+  velocity_window_ = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(std::max(value, 0.0)));
+}
+
+#pragma mark Samples
+
+inline void InputResampler::add(Clock::time_point time,
+                                const takram::Vec2d& position) {
+  if (size_ && time <= sample(0).time) {
+    // Samples out of order are dropped, and the ones at the same time as the
+    // latest replace its position.
+    if (time == sample(0).time) {
+      samples_[head_].position = position;
+    }
+    return;
+  }
+  head_ = (head_ + 1) % capacity;
+  samples_[head_].time = time;
+  samples_[head_].position = position;
+  if (size_ < capacity) {
+    ++size_;
+  }
+}
+
+inline const InputResampler::Sample& InputResampler::sample(
+    std::size_t age) const {
+  return samples_[(head_ + capacity - age) % capacity];
+}
+
+#pragma mark Estimation
+
+inline takram::Vec2d InputResampler::resample(Clock::time_point time) const {
+  if (!size_) {
+    return takram::Vec2d();
+  }
+  const auto& latest = sample(0);
+  if (size_ == 1) {
+    return latest.position;
+  }
+  if (time > latest.time) {
+    const auto& previous = sample(1);
+    const auto interval = latest.time - previous.time;
+    const auto ahead = std::min(std::min(time - latest.time,
+                                         extrapolation_limit_),
+                                interval / 2);
+    const auto t = (std::chrono::duration<double>(ahead) /
+                    std::chrono::duration<double>(interval));
+    return takram::Vec2d(
+        latest.position.x + (latest.position.x - previous.position.x) * t,
+        latest.position.y + (latest.position.y - previous.position.y) * t);
+  }
+  for (std::size_t age = 1; age < size_; ++age) {
+    const auto& earlier = sample(age);
+    if (earlier.time <= time) {
+      const auto& later = sample(age - 1);
+      const auto t = (std::chrono::duration<double>(time - earlier.time) /
+                      std::chrono::duration<double>(later.time - earlier.time));
+      return takram::Vec2d(
+          earlier.position.x + (later.position.x - earlier.position.x) * t,
+          earlier.position.y + (later.position.y - earlier.position.y) * t);
+    }
+  }
+  return sample(size_ - 1).position;
+}
+
+inline takram::Vec2d InputResampler::velocity(Clock::time_point time) const {
+  // Least squares fit of the samples within the window before the time
+  std::size_t count = 0;
+  double mean_t = 0.0;
+  double mean_x = 0.0;
+  double mean_y = 0.0;
+  for (; count < size_; ++count) {
+    const auto& current = sample(count);
+    if (time - current.time > velocity_window_) {
+      break;
+    }
+    mean_t += std::chrono::duration<double>(current.time - time).count();
+    mean_x += current.position.x;
+    mean_y += current.position.y;
+  }
+  if (count < 2) {
+    return takram::Vec2d();
+  }
+  mean_t /= count;
+  mean_x /= count;
+  mean_y /= count;
+  double variance = 0.0;
+  double covariance_x = 0.0;
+  double covariance_y = 0.0;
+  for (std::size_t age = 0; age < count; ++age) {
+    const auto& current = sample(age);
+    const auto t = (std::chrono::duration<double>(current.time - time).count() -
+                    mean_t);
+    variance += t * t;
+    covariance_x += t * (current.position.x - mean_x);
+    covariance_y += t * (current.position.y - mean_y);
+  }
+  if (variance <= 0.0) {
+    return takram::Vec2d();
+  }
+  return takram::Vec2d(covariance_x / variance, covariance_y / variance);
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_INPUT_RESAMPLER_H_
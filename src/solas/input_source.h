@@ -0,0 +1,60 @@
+//
+//  solas/input_source.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_INPUT_SOURCE_H_
+#define SOLAS_INPUT_SOURCE_H_
+
+namespace solas {
+
+class Runner;
+
+// Feeds events from outside the platform's event loop into a runner. The
+// runner polls each of its sources once a frame, just before the runnable
+// consumes input of the frame. Runners don't own their sources, which
+// must be removed before they are destroyed.
+class InputSource {
+ public:
+  virtual ~InputSource() = 0;
+
+  // Disallow copy semantics
+  InputSource(const InputSource&) = delete;
+  InputSource& operator=(const InputSource&) = delete;
+
+  // Polling events
+  virtual void poll(Runner& runner) = 0;
+
+ protected:
+  InputSource() = default;
+};
+
+#pragma mark -
+
+inline InputSource::~InputSource() {}
+
+}  // namespace solas
+
+#endif  // SOLAS_INPUT_SOURCE_H_
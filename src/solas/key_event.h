@@ -28,8 +28,10 @@
 #ifndef SOLAS_KEY_EVENT_H_
 #define SOLAS_KEY_EVENT_H_
 
+#include <chrono>
 #include <cstdint>
 #include <string>
+#include <utility>
 
 #include "solas/key_modifier.h"
 
@@ -43,24 +45,35 @@ class KeyEvent final {
     RELEASED
   };
 
+  using Clock = std::chrono::steady_clock;
+
  public:
   KeyEvent();
   KeyEvent(Type type,
            std::uint32_t code,
-           const std::string& characters,
+           std::string characters,
            KeyModifier modifiers);
 
   // Copy semantics excluding assignment
   KeyEvent(const KeyEvent&) = default;
   KeyEvent& operator=(const KeyEvent&) = delete;
 
+  // Move semantics excluding assignment
+  KeyEvent(KeyEvent&&) = default;
+  KeyEvent& operator=(KeyEvent&&) = delete;
+
   // Properties
   bool empty() const { return type_ == Type::UNDEFINED; }
   Type type() const { return type_; }
+  Clock::time_point timestamp() const { return timestamp_; }
+  void set_timestamp(Clock::time_point value) { timestamp_ = value; }
   std::uint32_t code() const { return code_; }
   const std::string& characters() const { return characters_; }
   KeyModifier modifiers() const { return modifiers_; }
 
+  // Releasing the payload
+  std::string releaseCharacters() { return std::move(characters_); }
+
   // Conversion
   operator bool() const { return !empty(); }
 
@@ -69,6 +82,7 @@ class KeyEvent final {
   std::uint32_t code_;
   std::string characters_;
   KeyModifier modifiers_;
+  Clock::time_point timestamp_;
 };
 
 #pragma mark -
@@ -80,12 +94,13 @@ inline KeyEvent::KeyEvent()
 
 inline KeyEvent::KeyEvent(Type type,
                           std::uint32_t code,
-                          const std::string& characters,
+                          std::string characters,
                           KeyModifier modifiers)
     : type_(type),
       code_(code),
-      characters_(characters),
-      modifiers_(modifiers) {}
+      characters_(std::move(characters)),
+      modifiers_(modifiers),
+      timestamp_(Clock::now()) {}
 
 }  // namespace solas
 
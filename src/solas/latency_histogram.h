@@ -0,0 +1,169 @@
+//
+//  solas/latency_histogram.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_LATENCY_HISTOGRAM_H_
+#define SOLAS_LATENCY_HISTOGRAM_H_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace solas {
+
+// Histogram of latencies in microseconds with buckets that are linear below
+// 16 microseconds and split every power of two into 16 above it, so that any
+// percentile is within about 6% of the recorded values. Latencies from about
+// 18 minutes up fall into the last bucket.
+class LatencyHistogram final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::size_t sub_buckets = 16;
+  static constexpr std::size_t max_exponent = 29;
+  static constexpr std::size_t buckets =
+      (max_exponent - 3) * sub_buckets + sub_buckets;
+
+ public:
+  LatencyHistogram();
+
+  // Copy semantics
+  LatencyHistogram(const LatencyHistogram&) = default;
+  LatencyHistogram& operator=(const LatencyHistogram&) = default;
+
+  // Recording
+  void record(Clock::duration latency);
+  void reset();
+
+  // Statistics in seconds
+  std::uint64_t count() const { return count_; }
+  double min() const;
+  double max() const;
+  double mean() const;
+  double percentile(double percent) const;
+
+ private:
+  static std::size_t index(std::uint64_t microseconds);
+  static std::uint64_t upperBound(std::size_t index);
+
+ private:
+  std::array<std::uint64_t, buckets> counts_;
+  std::uint64_t count_;
+  Clock::duration min_;
+  Clock::duration max_;
+  Clock::duration sum_;
+};
+
+#pragma mark -
+
+inline LatencyHistogram::LatencyHistogram()
+    : counts_(),
+      count_(),
+      min_(Clock::duration::max()),
+      max_(Clock::duration::zero()),
+      sum_(Clock::duration::zero()) {}
+
+#pragma mark Recording
+
+inline void LatencyHistogram::record(Clock::duration latency) {
+  latency = std::max(latency, Clock::duration::zero());
+  const auto microseconds = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+  ++counts_[index(microseconds)];
+  ++count_;
+  min_ = std::min(min_, latency);
+  max_ = std::max(max_, latency);
+  sum_ += latency;
+}
+
+inline void LatencyHistogram::reset() {
+  *this = LatencyHistogram();
+}
+
+#pragma mark Statistics
+
+inline double LatencyHistogram::min() const {
+  return count_ ? std::chrono::duration<double>(min_).count() : 0.0;
+}
+
+inline double LatencyHistogram::max() const {
+  return std::chrono::duration<double>(max_).count();
+}
+
+inline double LatencyHistogram::mean() const {
+  if (!count_) {
+    return 0.0;
+  }
+  return std::chrono::duration<double>(sum_).count() / count_;
+}
+
+inline double LatencyHistogram::percentile(double percent) const {
+  if (!count_) {
+    return 0.0;
+  }
+  const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(
+      std::ceil(std::min(std::max(percent, 0.0), 100.0) / 100.0 * count_)));
+  std::uint64_t accumulated = 0;
+  for (std::size_t i = 0; i < buckets; ++i) {
+    accumulated += counts_[i];
+    if (accumulated >= rank) {
+      // Report the upper bound of the bucket within the recorded range
+      const auto bound = upperBound(i) * 1.0e-6;
+      return std::min(std::max(bound, min()), max());
+    }
+  }
+  return max();
+}
+
+#pragma mark Buckets
+
+inline std::size_t LatencyHistogram::index(std::uint64_t microseconds) {
+  if (microseconds < sub_buckets) {
+    return microseconds;
+  }
+  std::size_t exponent = 63 - __builtin_clzll(microseconds);
+  if (exponent > max_exponent) {
+    return buckets - 1;
+  }
+  return ((exponent - 3) * sub_buckets +
+          (microseconds >> (exponent - 4)) - sub_buckets);
+}
+
+inline std::uint64_t LatencyHistogram::upperBound(std::size_t index) {
+  if (index < sub_buckets) {
+    return index + 1;
+  }
+  const auto exponent = index / sub_buckets + 3;
+  const auto base = (sub_buckets + index % sub_buckets) << (exponent - 4);
+  return base + (std::uint64_t(1) << (exponent - 4));
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_LATENCY_HISTOGRAM_H_
@@ -0,0 +1,64 @@
+//
+//  solas/latency_stage.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_LATENCY_STAGE_H_
+#define SOLAS_LATENCY_STAGE_H_
+
+#include <cassert>
+#include <ostream>
+
+namespace solas {
+
+// The points in the life of an event to which latency is measured from the
+// timestamp given at its source
+enum class LatencyStage : int {
+  ENQUEUE,
+  DISPATCH,
+  PRESENT
+};
+
+inline std::ostream& operator<<(std::ostream& os, LatencyStage stage) {
+  switch (stage) {
+    case LatencyStage::ENQUEUE:
+      os << "enqueue";
+      break;
+    case LatencyStage::DISPATCH:
+      os << "dispatch";
+      break;
+    case LatencyStage::PRESENT:
+      os << "present";
+      break;
+    default:
+      assert(false);
+      break;
+  }
+  return os;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_LATENCY_STAGE_H_
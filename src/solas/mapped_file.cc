@@ -0,0 +1,85 @@
+//
+//  solas/mapped_file.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <string>
+
+namespace solas {
+
+MappedFile::MappedFile() : data_(), size_() {}
+
+MappedFile::~MappedFile() {
+  close();
+}
+
+#pragma mark Mapping
+
+bool MappedFile::open(const std::string& path, bool sequential) {
+  close();
+  const auto descriptor = ::open(path.c_str(), O_RDONLY);
+  if (descriptor < 0) {
+    return false;
+  }
+  struct stat status;
+  if (fstat(descriptor, &status) < 0 || status.st_size <= 0) {
+    ::close(descriptor);
+    return false;
+  }
+  const auto size = static_cast<std::size_t>(status.st_size);
+  const auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE,
+                         descriptor, 0);
+  ::close(descriptor);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  if (sequential) {
+    // Let the kernel read ahead and drop pages behind the reader
+    madvise(data, size, MADV_SEQUENTIAL);
+  }
+  path_ = path;
+  data_ = data;
+  size_ = size;
+  return true;
+}
+
+void MappedFile::close() {
+  if (!data_) {
+    return;
+  }
+  munmap(data_, size_);
+  path_.clear();
+  data_ = nullptr;
+  size_ = 0;
+}
+
+}  // namespace solas
@@ -0,0 +1,66 @@
+//
+//  solas/mapped_file.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_MAPPED_FILE_H_
+#define SOLAS_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace solas {
+
+// Read-only memory mapping of a whole file. Pages are only read from the
+// file when they are first accessed, so that opening a large file takes no
+// time regardless of its size.
+class MappedFile final {
+ public:
+  MappedFile();
+  ~MappedFile();
+
+  // Disallow copy semantics
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Mapping
+  bool open(const std::string& path, bool sequential = false);
+  void close();
+  bool is_open() const { return data_; }
+
+  // Properties
+  const std::string& path() const { return path_; }
+  const void * data() const { return data_; }
+  std::size_t size() const { return size_; }
+
+ private:
+  std::string path_;
+  void *data_;
+  std::size_t size_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_MAPPED_FILE_H_
@@ -29,6 +29,7 @@
 #define SOLAS_MOTION_EVENT_H_
 
 #include <cassert>
+#include <chrono>
 #include <ostream>
 
 #include "solas/motion_kind.h"
@@ -44,6 +45,8 @@ class MotionEvent final {
     ENDED
   };
 
+  using Clock = std::chrono::steady_clock;
+
  public:
   MotionEvent();
   MotionEvent(Type type, MotionKind kind);
@@ -55,6 +58,8 @@ class MotionEvent final {
   // Properties
   bool empty() const { return type_ == Type::UNDEFINED; }
   Type type() const { return type_; }
+  Clock::time_point timestamp() const { return timestamp_; }
+  void set_timestamp(Clock::time_point value) { timestamp_ = value; }
   MotionKind kind() const { return kind_; }
 
   // Conversion
@@ -63,6 +68,7 @@ class MotionEvent final {
  private:
   Type type_;
   MotionKind kind_;
+  Clock::time_point timestamp_;
 };
 
 #pragma mark -
@@ -73,7 +79,8 @@ inline MotionEvent::MotionEvent()
 
 inline MotionEvent::MotionEvent(Type type, MotionKind kind)
     : type_(type),
-      kind_(kind) {}
+      kind_(kind),
+      timestamp_(Clock::now()) {}
 
 #pragma mark Stream
 
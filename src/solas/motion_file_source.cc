@@ -0,0 +1,147 @@
+//
+//  solas/motion_file_source.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/motion_file_source.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "solas/motion_sample.h"
+#include "solas/runner.h"
+#include "takram/math.h"
+
+namespace solas {
+
+MotionFileSource::MotionFileSource(Runner& runner)
+    : runner_(&runner),
+      loops_(false),
+      speed_(1.0),
+      running_(false) {}
+
+MotionFileSource::~MotionFileSource() {
+  stop();
+}
+
+#pragma mark Loading samples
+
+bool MotionFileSource::open(const std::string& path) {
+  assert(!running_);
+  times_.clear();
+  samples_.clear();
+  std::ifstream stream(path);
+  if (!stream) {
+    return false;
+  }
+  std::string line;
+  while (std::getline(stream, line)) {
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    double time;
+    takram::Vec3d acceleration;
+    takram::Vec3d rotation_rate;
+    if (!(fields >> time >>
+          acceleration.x >> acceleration.y >> acceleration.z >>
+          rotation_rate.x >> rotation_rate.y >> rotation_rate.z)) {
+      // Leave nothing to play rather than the samples up to this line
+      times_.clear();
+      samples_.clear();
+      return false;
+    }
+    times_.emplace_back(time);
+    samples_.emplace_back(acceleration, rotation_rate);
+  }
+  return true;
+}
+
+#pragma mark Playing samples
+
+void MotionFileSource::start() {
+  if (running_ || samples_.empty()) {
+    return;
+  }
+  running_ = true;
+  thread_ = std::thread(&MotionFileSource::run, this);
+}
+
+void MotionFileSource::stop() {
+  running_ = false;
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void MotionFileSource::run() {
+  // Wake up once per batch of samples that are due, instead of once per
+  // sample, because sensors run faster than sleeping is precise.
+  const auto resolution = std::chrono::milliseconds(1);
+  auto start = Clock::now();
+  std::size_t index = 0;
+  while (running_) {
+    const auto offset = (times_[index] - times_.front()) / speed_;
+    const auto due = start + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(offset));
+    const auto now = Clock::now();
+    if (due > now) {
+      std::this_thread::sleep_until(std::max(due, now + resolution));
+    }
+    auto sample = samples_[index];
+    sample.set_timestamp(due);
+    runner_->motionSampled(sample);
+    if (++index == samples_.size()) {
+      if (!loops_) {
+        break;
+      }
+      // Continue after the same interval as the last one
+      const auto interval = (samples_.size() > 1 ?
+          times_[index - 1] - times_[index - 2] : 0.0) / speed_;
+      start = due + std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double>(interval));
+      index = 0;
+    }
+  }
+  running_ = false;
+}
+
+#pragma mark Properties
+
+void MotionFileSource::set_speed(double value) {
+  // The time between samples is divided by the speed, which has to be
+  // positive for them to be played at all.
+  assert(value > 0.0);
+  if (value > 0.0) {
+    speed_ = value;
+  }
+}
+
+}  // namespace solas
@@ -0,0 +1,88 @@
+//
+//  solas/motion_file_source.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_MOTION_FILE_SOURCE_H_
+#define SOLAS_MOTION_FILE_SOURCE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "solas/motion_sample.h"
+#include "solas/runner.h"
+
+namespace solas {
+
+// Plays motion samples from a text file into a runner on a thread of its own,
+// standing in for a motion sensor where there is none. Each line holds the
+// time in seconds, the acceleration and the rotation rate, separated by
+// spaces, and lines starting with # are ignored.
+class MotionFileSource final {
+ public:
+  using Clock = MotionSample::Clock;
+
+ public:
+  explicit MotionFileSource(Runner& runner);
+  ~MotionFileSource();
+
+  // Disallow copy semantics
+  MotionFileSource(const MotionFileSource&) = delete;
+  MotionFileSource& operator=(const MotionFileSource&) = delete;
+
+  // Loading samples
+  bool open(const std::string& path);
+  std::size_t size() const { return samples_.size(); }
+
+  // Playing samples
+  void start();
+  void stop();
+  bool running() const { return running_; }
+
+  // Properties
+  bool loops() const { return loops_; }
+  void set_loops(bool value) { loops_ = value; }
+  double speed() const { return speed_; }
+  void set_speed(double value);
+
+ private:
+  void run();
+
+ private:
+  Runner *runner_;
+  std::vector<double> times_;
+  std::vector<MotionSample> samples_;
+  bool loops_;
+  double speed_;
+  std::atomic_bool running_;
+  std::thread thread_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_MOTION_FILE_SOURCE_H_
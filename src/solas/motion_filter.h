@@ -0,0 +1,182 @@
+//
+//  solas/motion_filter.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_MOTION_FILTER_H_
+#define SOLAS_MOTION_FILTER_H_
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+
+#include "solas/motion_sample.h"
+#include "solas/span.h"
+#include "takram/math.h"
+
+namespace solas {
+
+struct MotionState {
+  MotionSample::Clock::time_point timestamp;
+  takram::Vec3d acceleration;
+  takram::Vec3d gravity;
+  takram::Vec3d user_acceleration;
+  takram::Vec3d velocity;
+  takram::Vec3d rotation_rate;
+  takram::Vec3d rotation;
+};
+
+// Filters motion samples as they arrive. Both channels are low-passed at the
+// noise cutoff, the acceleration is split at the gravity cutoff into gravity
+// and user acceleration, and the user acceleration and rotation rate are
+// integrated into velocity and rotation. The filters are recursive in time,
+// so each sample updates all six channels at once instead.
+class MotionFilter final {
+ public:
+  MotionFilter();
+
+  // Copy semantics
+  MotionFilter(const MotionFilter&) = default;
+  MotionFilter& operator=(const MotionFilter&) = default;
+
+  // Properties
+  double noise_cutoff() const { return noise_cutoff_; }
+  void set_noise_cutoff(double value) { noise_cutoff_ = value; }
+  double gravity_cutoff() const { return gravity_cutoff_; }
+  void set_gravity_cutoff(double value) { gravity_cutoff_ = value; }
+  const MotionState& state() const { return state_; }
+
+  // Filtering
+  void filter(Span<const MotionSample> samples);
+  void reset();
+
+ private:
+  static constexpr std::size_t channels = 6;
+  using Channels = std::array<double, channels>;
+
+  static double smoothing(double cutoff, double interval);
+
+ private:
+  double noise_cutoff_;
+  double gravity_cutoff_;
+  MotionState state_;
+  bool primed_;
+  MotionSample::Clock::time_point time_;
+
+  // Acceleration followed by rotation rate in each array
+  Channels smoothed_;
+  Channels integral_;
+  std::array<double, 3> gravity_;
+  std::array<double, 3> user_;
+};
+
+#pragma mark -
+
+inline MotionFilter::MotionFilter()
+    : noise_cutoff_(20.0),
+      gravity_cutoff_(1.0) {
+  reset();
+}
+
+#pragma mark Filtering
+
+inline double MotionFilter::smoothing(double cutoff, double interval) {
+  // Weight of the new sample in a single pole low-pass filter
+  if (cutoff <= 0.0) {
+    return 1.0;
+  }
+  const auto rc = 1.0 / (2.0 * M_PI * cutoff);
+  return interval / (rc + interval);
+}
+
+inline void MotionFilter::filter(Span<const MotionSample> samples) {
+  if (samples.empty()) {
+    return;
+  }
+  for (const auto& sample : samples) {
+    const Channels input = {{
+      sample.acceleration().x,
+      sample.acceleration().y,
+      sample.acceleration().z,
+      sample.rotation_rate().x,
+      sample.rotation_rate().y,
+      sample.rotation_rate().z
+    }};
+    if (!primed_) {
+      primed_ = true;
+      time_ = sample.timestamp();
+      smoothed_ = input;
+      for (std::size_t i = 0; i < 3; ++i) {
+        gravity_[i] = input[i];
+        user_[i] = 0.0;
+      }
+      continue;
+    }
+    const auto interval = std::chrono::duration<double>(
+        sample.timestamp() - time_).count();
+    if (interval <= 0.0) {
+      continue;
+    }
+    time_ = sample.timestamp();
+    const auto noise = smoothing(noise_cutoff_, interval);
+    const auto gravity = smoothing(gravity_cutoff_, interval);
+    const auto previous = smoothed_;
+    for (std::size_t i = 0; i < channels; ++i) {
+      smoothed_[i] += noise * (input[i] - smoothed_[i]);
+    }
+    for (std::size_t i = 0; i < 3; ++i) {
+      gravity_[i] += gravity * (smoothed_[i] - gravity_[i]);
+      const auto user = smoothed_[i] - gravity_[i];
+      integral_[i] += (user_[i] + user) / 2.0 * interval;
+      user_[i] = user;
+    }
+    for (std::size_t i = 3; i < channels; ++i) {
+      integral_[i] += (previous[i] + smoothed_[i]) / 2.0 * interval;
+    }
+  }
+  state_.timestamp = time_;
+  state_.acceleration = takram::Vec3d(smoothed_[0], smoothed_[1],
+                                      smoothed_[2]);
+  state_.gravity = takram::Vec3d(gravity_[0], gravity_[1], gravity_[2]);
+  state_.user_acceleration = takram::Vec3d(user_[0], user_[1], user_[2]);
+  state_.velocity = takram::Vec3d(integral_[0], integral_[1], integral_[2]);
+  state_.rotation_rate = takram::Vec3d(smoothed_[3], smoothed_[4],
+                                       smoothed_[5]);
+  state_.rotation = takram::Vec3d(integral_[3], integral_[4], integral_[5]);
+}
+
+inline void MotionFilter::reset() {
+  state_ = MotionState();
+  primed_ = false;
+  smoothed_.fill(0.0);
+  integral_.fill(0.0);
+  gravity_.fill(0.0);
+  user_.fill(0.0);
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_MOTION_FILTER_H_
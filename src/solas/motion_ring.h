@@ -0,0 +1,132 @@
+//
+//  solas/motion_ring.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_MOTION_RING_H_
+#define SOLAS_MOTION_RING_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "solas/motion_sample.h"
+
+namespace solas {
+
+// Lock-free ring of motion samples between a single sensor thread and the
+// thread that runs the view. Samples pushed while the ring is full are
+// dropped and counted, so the sensor never waits for a frame.
+class MotionRing final {
+ public:
+  static constexpr std::size_t default_capacity = 1024;
+
+ public:
+  explicit MotionRing(std::size_t capacity = default_capacity);
+
+  // Disallow copy semantics
+  MotionRing(const MotionRing&) = delete;
+  MotionRing& operator=(const MotionRing&) = delete;
+
+  // Properties
+  std::size_t capacity() const { return samples_.size(); }
+  std::size_t size() const;
+  std::size_t dropped() const;
+
+  // Producer
+  bool push(const MotionSample& sample);
+
+  // Consumer
+  std::size_t pop(MotionSample *samples, std::size_t count);
+
+ private:
+  std::vector<MotionSample> samples_;
+  std::size_t mask_;
+
+  // The indices only grow, and live on their own cache lines so that the
+  // producer and the consumer don't invalidate each other's.
+  alignas(64) std::atomic<std::size_t> head_;
+  alignas(64) std::atomic<std::size_t> tail_;
+  std::atomic<std::size_t> dropped_;
+};
+
+#pragma mark -
+
+inline MotionRing::MotionRing(std::size_t capacity)
+    : head_(),
+      tail_(),
+      dropped_() {
+  std::size_t size = 1;
+  while (size < capacity) {
+    size *= 2;
+  }
+  samples_.resize(size);
+  mask_ = size - 1;
+}
+
+#pragma mark Properties
+
+inline std::size_t MotionRing::size() const {
+  // Load the head first, which only ever trails the tail, so that a pop in
+  // between can't make the difference underflow.
+  const auto head = head_.load(std::memory_order_acquire);
+  const auto tail = tail_.load(std::memory_order_acquire);
+  return tail - head;
+}
+
+inline std::size_t MotionRing::dropped() const {
+  return dropped_.load(std::memory_order_relaxed);
+}
+
+#pragma mark Producer
+
+inline bool MotionRing::push(const MotionSample& sample) {
+  const auto tail = tail_.load(std::memory_order_relaxed);
+  if (tail - head_.load(std::memory_order_acquire) == samples_.size()) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  samples_[tail & mask_] = sample;
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+#pragma mark Consumer
+
+inline std::size_t MotionRing::pop(MotionSample *samples, std::size_t count) {
+  const auto head = head_.load(std::memory_order_relaxed);
+  const auto tail = tail_.load(std::memory_order_acquire);
+  count = std::min(count, tail - head);
+  for (std::size_t i = 0; i < count; ++i) {
+    samples[i] = samples_[(head + i) & mask_];
+  }
+  head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_MOTION_RING_H_
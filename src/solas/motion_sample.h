@@ -0,0 +1,78 @@
+//
+//  solas/motion_sample.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_MOTION_SAMPLE_H_
+#define SOLAS_MOTION_SAMPLE_H_
+
+#include <chrono>
+
+#include "takram/math.h"
+
+namespace solas {
+
+// A reading of a motion sensor, with the acceleration in units of gravity and
+// the rotation rate in radians per second around each axis.
+class MotionSample final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  MotionSample() = default;
+  MotionSample(const takram::Vec3d& acceleration,
+               const takram::Vec3d& rotation_rate);
+
+  // Copy semantics
+  MotionSample(const MotionSample&) = default;
+  MotionSample& operator=(const MotionSample&) = default;
+
+  // Properties
+  Clock::time_point timestamp() const { return timestamp_; }
+  void set_timestamp(Clock::time_point value) { timestamp_ = value; }
+  const takram::Vec3d& acceleration() const { return acceleration_; }
+  void set_acceleration(const takram::Vec3d& value) { acceleration_ = value; }
+  const takram::Vec3d& rotation_rate() const { return rotation_rate_; }
+  void set_rotation_rate(const takram::Vec3d& value) {
+    rotation_rate_ = value;
+  }
+
+ private:
+  Clock::time_point timestamp_;
+  takram::Vec3d acceleration_;
+  takram::Vec3d rotation_rate_;
+};
+
+#pragma mark -
+
+inline MotionSample::MotionSample(const takram::Vec3d& acceleration,
+                                  const takram::Vec3d& rotation_rate)
+    : timestamp_(Clock::now()),
+      acceleration_(acceleration),
+      rotation_rate_(rotation_rate) {}
+
+}  // namespace solas
+
+#endif  // SOLAS_MOTION_SAMPLE_H_
@@ -0,0 +1,119 @@
+//
+//  solas/motion_window.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_MOTION_WINDOW_H_
+#define SOLAS_MOTION_WINDOW_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "solas/motion_ring.h"
+#include "solas/motion_sample.h"
+#include "solas/span.h"
+
+namespace solas {
+
+// Latest motion samples in a contiguous array, oldest first. The storage is
+// twice as large as the window, so that the window only moves back to the
+// front once every so many samples.
+class MotionWindow final {
+ public:
+  static constexpr std::size_t default_size = 256;
+
+ public:
+  explicit MotionWindow(std::size_t size = default_size);
+
+  // Copy semantics
+  MotionWindow(const MotionWindow&) = default;
+  MotionWindow& operator=(const MotionWindow&) = default;
+
+  // Properties
+  std::size_t size() const { return size_; }
+  Span<const MotionSample> samples() const;
+
+  // Filling the window
+  template <class Callback>
+  std::size_t fill(MotionRing& ring, Callback&& callback);
+  void clear();
+
+ private:
+  std::size_t size_;
+  std::vector<MotionSample> storage_;
+  std::size_t begin_;
+  std::size_t end_;
+};
+
+#pragma mark -
+
+inline MotionWindow::MotionWindow(std::size_t size)
+    : size_(std::max<std::size_t>(size, 1)),
+      storage_(2 * size_),
+      begin_(),
+      end_() {}
+
+#pragma mark Properties
+
+inline Span<const MotionSample> MotionWindow::samples() const {
+  return Span<const MotionSample>(storage_.data() + begin_, end_ - begin_);
+}
+
+#pragma mark Filling the window
+
+template <class Callback>
+inline std::size_t MotionWindow::fill(MotionRing& ring, Callback&& callback) {
+  // The callback sees every new sample in order, even when more samples
+  // arrive than the window holds.
+  std::size_t total = 0;
+  while (true) {
+    if (end_ == storage_.size()) {
+      std::copy(storage_.begin() + end_ - size_, storage_.end(),
+                storage_.begin());
+      begin_ = 0;
+      end_ = size_;
+    }
+    const auto count = ring.pop(storage_.data() + end_,
+                                storage_.size() - end_);
+    if (!count) {
+      break;
+    }
+    callback(Span<const MotionSample>(storage_.data() + end_, count));
+    end_ += count;
+    begin_ = std::max(begin_, end_ - std::min(end_, size_));
+    total += count;
+  }
+  return total;
+}
+
+inline void MotionWindow::clear() {
+  begin_ = 0;
+  end_ = 0;
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_MOTION_WINDOW_H_
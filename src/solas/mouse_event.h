@@ -28,10 +28,12 @@
 #ifndef SOLAS_MOUSE_EVENT_H_
 #define SOLAS_MOUSE_EVENT_H_
 
+#include <chrono>
 #include <cstdint>
 
 #include "solas/key_modifier.h"
 #include "solas/mouse_button.h"
+#include "solas/span.h"
 #include "takram/math.h"
 
 namespace solas {
@@ -49,6 +51,8 @@ class MouseEvent final {
     WHEEL
   };
 
+  using Clock = std::chrono::steady_clock;
+
  public:
   MouseEvent();
   MouseEvent(Type type,
@@ -58,17 +62,23 @@ class MouseEvent final {
              const takram::Vec3d& wheel = takram::Vec3d());
 
   // Copy semantics excluding assignment
-  MouseEvent(const MouseEvent&) = default;
+  MouseEvent(const MouseEvent& other);
   MouseEvent& operator=(const MouseEvent&) = delete;
 
   // Properties
   bool empty() const { return type_ == Type::UNDEFINED; }
   Type type() const { return type_; }
+  Clock::time_point timestamp() const { return timestamp_; }
+  void set_timestamp(Clock::time_point value) { timestamp_ = value; }
   const takram::Vec2d& location() const { return location_; }
   MouseButton button() const { return button_; }
   KeyModifier modifiers() const { return modifiers_; }
   const takram::Vec3d& wheel() const { return wheel_; }
 
+  // Coalescing
+  Span<const MouseEvent> coalesced() const;
+  void set_coalesced(Span<const MouseEvent> value) { coalesced_ = value; }
+
   // Conversion
   operator bool() const { return !empty(); }
 
@@ -78,6 +88,8 @@ class MouseEvent final {
   MouseButton button_;
   KeyModifier modifiers_;
   takram::Vec3d wheel_;
+  Span<const MouseEvent> coalesced_;
+  Clock::time_point timestamp_;
 };
 
 #pragma mark -
@@ -96,7 +108,29 @@ inline MouseEvent::MouseEvent(Type type,
       location_(location),
       button_(button),
       modifiers_(modifiers),
-      wheel_(wheel) {}
+      wheel_(wheel),
+      timestamp_(Clock::now()) {}
+
+inline MouseEvent::MouseEvent(const MouseEvent& other)
+    : type_(other.type_),
+      location_(other.location_),
+      button_(other.button_),
+      modifiers_(other.modifiers_),
+      wheel_(other.wheel_),
+      timestamp_(other.timestamp_) {
+  // The coalesced samples only live until the handler of the event returns,
+  // so a copy is no more than the latest of them.
+}
+
+#pragma mark Coalescing
+
+inline Span<const MouseEvent> MouseEvent::coalesced() const {
+  // Every event is a coalesced sample of itself unless it was merged
+  if (coalesced_.empty()) {
+    return Span<const MouseEvent>(this, 1);
+  }
+  return coalesced_;
+}
 
 }  // namespace solas
 
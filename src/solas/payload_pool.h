@@ -0,0 +1,182 @@
+//
+//  solas/payload_pool.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_PAYLOAD_POOL_H_
+#define SOLAS_PAYLOAD_POOL_H_
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "solas/event_holder.h"
+#include "solas/touch_event.h"
+#include "takram/math.h"
+
+namespace solas {
+
+// Keeps touch and contact arrays and key characters of dequeued events, so
+// that event sources can fill them again without allocating once input is
+// steady.
+class PayloadPool final {
+ public:
+  static constexpr std::size_t capacity = 256;
+
+ public:
+  // Disallow copy semantics
+  PayloadPool(const PayloadPool&) = delete;
+  PayloadPool& operator=(const PayloadPool&) = delete;
+
+  // Shared instance
+  static PayloadPool& shared();
+
+  // Acquiring payloads
+  std::vector<takram::Vec2d> touches();
+  std::vector<TouchEvent::Contact> contacts();
+  std::string characters();
+
+  // Recycling payloads
+  void recycle(std::vector<takram::Vec2d>&& touches);
+  void recycle(std::vector<TouchEvent::Contact>&& contacts);
+  void recycle(std::string&& characters);
+  void recycle(EventHolder& event);
+
+ private:
+  PayloadPool();
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::vector<takram::Vec2d>> touches_;
+  std::vector<std::vector<TouchEvent::Contact>> contacts_;
+  std::vector<std::string> characters_;
+};
+
+#pragma mark -
+
+inline PayloadPool::PayloadPool() {
+  touches_.reserve(capacity);
+  contacts_.reserve(capacity);
+  characters_.reserve(capacity);
+}
+
+#pragma mark Shared instance
+
+inline PayloadPool& PayloadPool::shared() {
+  static PayloadPool instance;
+  return instance;
+}
+
+#pragma mark Acquiring payloads
+
+inline std::vector<takram::Vec2d> PayloadPool::touches() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (touches_.empty()) {
+    return std::vector<takram::Vec2d>();
+  }
+  auto touches = std::move(touches_.back());
+  touches_.pop_back();
+  return touches;
+}
+
+inline std::vector<TouchEvent::Contact> PayloadPool::contacts() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (contacts_.empty()) {
+    return std::vector<TouchEvent::Contact>();
+  }
+  auto contacts = std::move(contacts_.back());
+  contacts_.pop_back();
+  return contacts;
+}
+
+inline std::string PayloadPool::characters() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (characters_.empty()) {
+    return std::string();
+  }
+  auto characters = std::move(characters_.back());
+  characters_.pop_back();
+  return characters;
+}
+
+#pragma mark Recycling payloads
+
+inline void PayloadPool::recycle(std::vector<takram::Vec2d>&& touches) {
+  if (!touches.capacity()) {
+    return;
+  }
+  touches.clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (touches_.size() < capacity) {
+    touches_.emplace_back(std::move(touches));
+  }
+}
+
+inline void PayloadPool::recycle(
+    std::vector<TouchEvent::Contact>&& contacts) {
+  if (!contacts.capacity()) {
+    return;
+  }
+  contacts.clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (contacts_.size() < capacity) {
+    contacts_.emplace_back(std::move(contacts));
+  }
+}
+
+inline void PayloadPool::recycle(std::string&& characters) {
+  // Short strings don't own any storage worth keeping
+  if (characters.capacity() <= std::string().capacity()) {
+    return;
+  }
+  characters.clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (characters_.size() < capacity) {
+    characters_.emplace_back(std::move(characters));
+  }
+}
+
+inline void PayloadPool::recycle(EventHolder& event) {
+  switch (event.type()) {
+    case EventHolder::Type::KEY:
+      recycle(event.key().releaseCharacters());
+      break;
+    case EventHolder::Type::TOUCH:
+      recycle(event.touch().releaseTouches());
+      recycle(event.touch().releaseContacts());
+      break;
+    case EventHolder::Type::GESTURE:
+      recycle(event.gesture().releaseTouches());
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_PAYLOAD_POOL_H_
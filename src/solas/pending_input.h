@@ -0,0 +1,168 @@
+//
+//  solas/pending_input.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_PENDING_INPUT_H_
+#define SOLAS_PENDING_INPUT_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include <boost/optional.hpp>
+
+#include "solas/key_event.h"
+#include "solas/mouse_button.h"
+#include "solas/mouse_event.h"
+#include "takram/math.h"
+
+namespace solas {
+
+// Latest input state carried by mouse and key events that no handler
+// observes. Any thread can merge events into it, and the view takes it once
+// per frame instead of queuing and dispatching those events. Every field
+// keeps the timestamp of the event it comes from, so that the view can order
+// it against the events it dequeues. Touch events are always queued instead,
+// because the touch tracker follows every one of them.
+class PendingInput final {
+ public:
+  struct State {
+    boost::optional<takram::Vec2d> mouse;
+    MouseEvent::Clock::time_point mouse_time;
+    boost::optional<MouseButton> mouse_button;
+    boost::optional<bool> mouse_pressed;
+    MouseEvent::Clock::time_point mouse_button_time;
+    boost::optional<char> key;
+    boost::optional<std::uint32_t> key_code;
+    boost::optional<bool> key_pressed;
+    KeyEvent::Clock::time_point key_time;
+  };
+
+ public:
+  PendingInput();
+
+  // Disallow copy semantics
+  PendingInput(const PendingInput&) = delete;
+  PendingInput& operator=(const PendingInput&) = delete;
+
+  // Merging events
+  void merge(const MouseEvent& event);
+  void merge(const KeyEvent& event);
+  template <class Event>
+  void merge(const Event& event) {}
+
+  // Taking the state
+  bool take(State& state);
+
+ private:
+  void lock();
+  void unlock();
+
+ private:
+  std::atomic_flag lock_;
+  std::atomic_bool pending_;
+  State state_;
+};
+
+#pragma mark -
+
+inline PendingInput::PendingInput()
+    : lock_(ATOMIC_FLAG_INIT),
+      pending_(false) {}
+
+#pragma mark Merging events
+
+inline void PendingInput::merge(const MouseEvent& event) {
+  lock();
+  switch (event.type()) {
+    case MouseEvent::Type::PRESSED:
+      state_.mouse = event.location();
+      state_.mouse_time = event.timestamp();
+      state_.mouse_pressed = true;
+      break;
+    case MouseEvent::Type::RELEASED:
+      state_.mouse_pressed = false;
+      break;
+    case MouseEvent::Type::DRAGGED:
+    case MouseEvent::Type::MOVED:
+      state_.mouse = event.location();
+      state_.mouse_time = event.timestamp();
+      break;
+    default:
+      break;
+  }
+  state_.mouse_button = event.button();
+  state_.mouse_button_time = event.timestamp();
+  pending_.store(true, std::memory_order_release);
+  unlock();
+}
+
+inline void PendingInput::merge(const KeyEvent& event) {
+  const auto str = event.characters().c_str();
+  lock();
+  state_.key = str ? *str : char();
+  state_.key_code = event.code();
+  state_.key_time = event.timestamp();
+  switch (event.type()) {
+    case KeyEvent::Type::PRESSED:
+      state_.key_pressed = true;
+      break;
+    case KeyEvent::Type::RELEASED:
+      state_.key_pressed = false;
+      break;
+    default:
+      break;
+  }
+  pending_.store(true, std::memory_order_release);
+  unlock();
+}
+
+#pragma mark Taking the state
+
+inline bool PendingInput::take(State& state) {
+  if (!pending_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  lock();
+  state = state_;
+  state_ = State();
+  pending_.store(false, std::memory_order_relaxed);
+  unlock();
+  return true;
+}
+
+#pragma mark Locking
+
+inline void PendingInput::lock() {
+  while (lock_.test_and_set(std::memory_order_acquire)) {}
+}
+
+inline void PendingInput::unlock() {
+  lock_.clear(std::memory_order_release);
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_PENDING_INPUT_H_
@@ -33,7 +33,9 @@
 #include "solas/gesture_event.h"
 #include "solas/key_event.h"
 #include "solas/motion_event.h"
+#include "solas/motion_sample.h"
 #include "solas/mouse_event.h"
+#include "solas/runner_options.h"
 #include "solas/touch_event.h"
 
 namespace solas {
@@ -48,6 +50,16 @@ class Runnable {
   virtual ~Runnable() = 0;
 
  protected:
+  // Configuration
+  virtual void configure(const RunnerOptions& options) {}
+
+  // Event observation
+  virtual bool observes(MouseEvent::Type type) const { return true; }
+  virtual bool observes(KeyEvent::Type type) const { return true; }
+  virtual bool observes(TouchEvent::Type type) const { return true; }
+  virtual bool observes(GestureEvent::Type type) const { return true; }
+  virtual bool observes(MotionEvent::Type type) const { return true; }
+
   // Lifecycle
   virtual void setup(const AppEvent& event, const Runner&) = 0;
   virtual void update(const AppEvent& event, const Runner&) = 0;
@@ -77,12 +89,72 @@ class Runnable {
   virtual void motionBegan(const MotionEvent& event, const Runner&) = 0;
   virtual void motionCancelled(const MotionEvent& event, const Runner&) = 0;
   virtual void motionEnded(const MotionEvent& event, const Runner&) = 0;
+
+  // Motion samples
+  virtual void motionSampled(const MotionSample& sample, const Runner&) {}
+
+  // Events with payloads to move
+  virtual void keyPressed(KeyEvent&& event, const Runner& runner);
+  virtual void keyReleased(KeyEvent&& event, const Runner& runner);
+  virtual void touchesBegan(TouchEvent&& event, const Runner& runner);
+  virtual void touchesMoved(TouchEvent&& event, const Runner& runner);
+  virtual void touchesCancelled(TouchEvent&& event, const Runner& runner);
+  virtual void touchesEnded(TouchEvent&& event, const Runner& runner);
+  virtual void gestureBegan(GestureEvent&& event, const Runner& runner);
+  virtual void gestureChanged(GestureEvent&& event, const Runner& runner);
+  virtual void gestureCancelled(GestureEvent&& event, const Runner& runner);
+  virtual void gestureEnded(GestureEvent&& event, const Runner& runner);
 };
 
 #pragma mark -
 
 inline Runnable::~Runnable() {}
 
+#pragma mark Events with payloads to move
+
+inline void Runnable::keyPressed(KeyEvent&& event, const Runner& runner) {
+  keyPressed(static_cast<const KeyEvent&>(event), runner);
+}
+
+inline void Runnable::keyReleased(KeyEvent&& event, const Runner& runner) {
+  keyReleased(static_cast<const KeyEvent&>(event), runner);
+}
+
+inline void Runnable::touchesBegan(TouchEvent&& event, const Runner& runner) {
+  touchesBegan(static_cast<const TouchEvent&>(event), runner);
+}
+
+inline void Runnable::touchesMoved(TouchEvent&& event, const Runner& runner) {
+  touchesMoved(static_cast<const TouchEvent&>(event), runner);
+}
+
+inline void Runnable::touchesCancelled(TouchEvent&& event,
+                                       const Runner& runner) {
+  touchesCancelled(static_cast<const TouchEvent&>(event), runner);
+}
+
+inline void Runnable::touchesEnded(TouchEvent&& event, const Runner& runner) {
+  touchesEnded(static_cast<const TouchEvent&>(event), runner);
+}
+
+inline void Runnable::gestureBegan(GestureEvent&& event, const Runner& runner) {
+  gestureBegan(static_cast<const GestureEvent&>(event), runner);
+}
+
+inline void Runnable::gestureChanged(GestureEvent&& event,
+                                     const Runner& runner) {
+  gestureChanged(static_cast<const GestureEvent&>(event), runner);
+}
+
+inline void Runnable::gestureCancelled(GestureEvent&& event,
+                                       const Runner& runner) {
+  gestureCancelled(static_cast<const GestureEvent&>(event), runner);
+}
+
+inline void Runnable::gestureEnded(GestureEvent&& event, const Runner& runner) {
+  gestureEnded(static_cast<const GestureEvent&>(event), runner);
+}
+
 }  // namespace solas
 
 #endif  // SOLAS_RUNNABLE_H_
@@ -28,14 +28,25 @@
 #ifndef SOLAS_RUNNER_H_
 #define SOLAS_RUNNER_H_
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
 
 #include "solas/app_event.h"
+#include "solas/event_recorder.h"
+#include "solas/frame_worker.h"
 #include "solas/gesture_event.h"
+#include "solas/gesture_recognizer.h"
+#include "solas/input_source.h"
 #include "solas/key_event.h"
 #include "solas/motion_event.h"
+#include "solas/motion_sample.h"
 #include "solas/mouse_event.h"
 #include "solas/runnable.h"
 #include "solas/runner_delegate.h"
@@ -91,6 +102,27 @@ class Runner final {
   void motionBegan(const MotionEvent& event);
   void motionCancelled(const MotionEvent& event);
   void motionEnded(const MotionEvent& event);
+  void keyPressed(KeyEvent&& event);
+  void keyReleased(KeyEvent&& event);
+  void touchesBegan(TouchEvent&& event);
+  void touchesMoved(TouchEvent&& event);
+  void touchesCancelled(TouchEvent&& event);
+  void touchesEnded(TouchEvent&& event);
+  void gestureBegan(GestureEvent&& event);
+  void gestureChanged(GestureEvent&& event);
+  void gestureCancelled(GestureEvent&& event);
+  void gestureEnded(GestureEvent&& event);
+
+  // Motion samples
+  void motionSampled(const MotionSample& sample);
+
+  // Input sources
+  void addInputSource(InputSource *source);
+  void removeInputSource(InputSource *source);
+
+  // Event observation
+  template <class Type>
+  bool observes(Type type) const;
 
   // Options
   const RunnerOptions& options() const { return options_; }
@@ -99,11 +131,35 @@ class Runner final {
   RunnerDelegate * delegate() const { return delegate_; }
   void set_delegate(RunnerDelegate *value) { delegate_ = value; }
 
+  // Recording events
+  EventRecorder * recorder() const { return recorder_; }
+  void set_recorder(EventRecorder *value) { recorder_ = value; }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  // Updating the runnable
+  void advance(const AppEvent& event);
+  void step(const AppEvent& event);
+
+  // Recognizing gestures
+  void recognizeGestures(const TouchEvent& event);
+
  private:
   std::unique_ptr<Runnable> runnable_;
   std::atomic_bool setup_;
   RunnerOptions options_;
   RunnerDelegate *delegate_;
+  EventRecorder *recorder_;
+  Clock::time_point step_time_;
+  Clock::duration step_lag_;
+  double alpha_;
+  bool update_pending_;
+  boost::optional<AppEvent> update_event_;
+  std::unique_ptr<FrameWorker> worker_;
+  std::unique_ptr<GestureRecognizer> gesture_recognizer_;
+  bool gestures_skipped_;
+  std::vector<InputSource *> input_sources_;
 };
 
 #pragma mark -
@@ -111,16 +167,43 @@ class Runner final {
 inline Runner::Runner(std::unique_ptr<Runnable>&& runnable)
     : runnable_(std::move(runnable)),
       setup_(false),
-      delegate_(nullptr) {}
+      delegate_(nullptr),
+      recorder_(nullptr),
+      step_lag_(),
+      alpha_(1.0),
+      update_pending_(false),
+      gestures_skipped_(false) {
+  if (runnable_) {
+    runnable_->configure(options_);
+  }
+}
 
 inline Runner::Runner(std::unique_ptr<Runnable>&& runnable,
                       const RunnerOptions& options)
     : runnable_(std::move(runnable)),
       options_(options),
       setup_(false),
-      delegate_(nullptr) {}
+      delegate_(nullptr),
+      recorder_(nullptr),
+      step_lag_(),
+      alpha_(1.0),
+      update_pending_(false),
+      gestures_skipped_(false) {
+  if (runnable_) {
+    runnable_->configure(options_);
+  }
+  if (options_.recognizes_gestures()) {
+    gesture_recognizer_ = std::make_unique<GestureRecognizer>();
+  }
+  if (options_.pipelined()) {
+    worker_ = std::make_unique<FrameWorker>([this] {
+      advance(*update_event_);
+    });
+  }
+}
 
 inline Runner::~Runner() {
+  worker_.reset();
   exit(AppEvent(AppEvent::Type::EXIT));
 }
 
@@ -134,20 +217,58 @@ inline void Runner::setup(const AppEvent& event) {
 
 inline void Runner::update(const AppEvent& event) {
   if (runnable_ && setup_) {
-    runnable_->update(event, *this);
+    if (worker_) {
+      // The worker performs this update while the next draw is in progress.
+      // The event is not kept, because its context may not outlive this call.
+      update_pending_ = true;
+    } else {
+      advance(event);
+    }
   }
 }
 
 inline void Runner::draw(const AppEvent& event) {
   if (runnable_) {
+    if (gesture_recognizer_) {
+      gesture_recognizer_->set_bounds(event.size());
+    }
     if (!setup_.exchange(true)) {
       // Setup and update when it's the first time to draw
       runnable_->setup(event, *this);
       runnable_->update(event, *this);
+      step_time_ = Clock::now();
+      step_lag_ = Clock::duration::zero();
+      alpha_ = 1.0;
     }
-    runnable_->pre(event, *this);
-    runnable_->draw(event, *this);
-    runnable_->post(event, *this);
+    boost::optional<AppEvent> interpolated;
+    if (options_.update_rate() > 0.0) {
+      interpolated.emplace(event);
+      interpolated->set_alpha(alpha_);
+    }
+    const AppEvent& current = interpolated ? *interpolated : event;
+    for (const auto& source : input_sources_) {
+      source->poll(*this);
+    }
+    if (recorder_) {
+      // Events recorded so far are the input of this frame
+      recorder_->recordFrame();
+    }
+    runnable_->pre(current, *this);
+    if (worker_ && update_pending_) {
+      // Input state only changes in pre, and the worker is done before post,
+      // so that draw and the next update see the same state of this frame.
+      // The update takes the context of the draw, which outlives the worker.
+      update_pending_ = false;
+      update_event_.emplace(event);
+      update_event_->set_type(AppEvent::Type::UPDATE);
+      worker_->post();
+      runnable_->draw(current, *this);
+      worker_->wait();
+      update_event_.reset();
+    } else {
+      runnable_->draw(current, *this);
+    }
+    runnable_->post(current, *this);
   }
 }
 
@@ -160,6 +281,44 @@ inline void Runner::exit(const AppEvent& event) {
   }
 }
 
+#pragma mark Updating the runnable
+
+inline void Runner::advance(const AppEvent& event) {
+  if (options_.update_rate() > 0.0) {
+    step(event);
+  } else {
+    runnable_->update(event, *this);
+  }
+}
+
+inline void Runner::step(const AppEvent& event) {
+  const auto now = Clock::now();
+  const auto period = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(1.0 / options_.update_rate()));
+  step_lag_ += now - step_time_;
+  step_time_ = now;
+  std::size_t steps = 0;
+  while (step_lag_ >= period && steps < options_.max_update_steps()) {
+    runnable_->update(event, *this);
+    step_lag_ -= period;
+    ++steps;
+  }
+  if (step_lag_ >= period) {
+    // Drop the time we couldn't catch up with, so that a long stall doesn't
+    // keep the simulation saturated for the following frames.
+    step_lag_ %= period;
+  }
+  alpha_ = std::chrono::duration<double>(step_lag_) /
+           std::chrono::duration<double>(period);
+}
+
+#pragma mark Event observation
+
+template <class Type>
+inline bool Runner::observes(Type type) const {
+  return runnable_ && runnable_->observes(type);
+}
+
 #pragma mark Environment
 
 inline void Runner::frameRate(double fps) const {
@@ -184,66 +343,100 @@ inline void Runner::fullScreen(bool flag) const {
 
 inline void Runner::mousePressed(const MouseEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->mousePressed(event, *this);
   }
 }
 
 inline void Runner::mouseDragged(const MouseEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->mouseDragged(event, *this);
   }
 }
 
 inline void Runner::mouseReleased(const MouseEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->mouseReleased(event, *this);
   }
 }
 
 inline void Runner::mouseMoved(const MouseEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->mouseMoved(event, *this);
   }
 }
 
 inline void Runner::mouseEntered(const MouseEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->mouseEntered(event, *this);
   }
 }
 
 inline void Runner::mouseExited(const MouseEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->mouseExited(event, *this);
   }
 }
 
 inline void Runner::mouseWheel(const MouseEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->mouseWheel(event, *this);
   }
 }
 
 inline void Runner::keyPressed(const KeyEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->keyPressed(event, *this);
   }
 }
 
 inline void Runner::keyReleased(const KeyEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->keyReleased(event, *this);
   }
 }
 
 inline void Runner::touchesBegan(const TouchEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    if (gesture_recognizer_) {
+      recognizeGestures(event);
+    }
     runnable_->touchesBegan(event, *this);
     if (options_.translates_touches() && !event.touches().empty()) {
-      const MouseEvent mouse_event(MouseEvent::Type::PRESSED,
-                                   event.touches().front(),
-                                   MouseButton::LEFT,
-                                   KeyModifier::NONE);
+      MouseEvent mouse_event(MouseEvent::Type::PRESSED,
+                             event.touches().front(),
+                             MouseButton::LEFT,
+                             KeyModifier::NONE);
+      mouse_event.set_timestamp(event.timestamp());
       runnable_->mousePressed(mouse_event, *this);
     }
   }
@@ -251,12 +444,19 @@ inline void Runner::touchesBegan(const TouchEvent& event) {
 
 inline void Runner::touchesMoved(const TouchEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    if (gesture_recognizer_) {
+      recognizeGestures(event);
+    }
     runnable_->touchesMoved(event, *this);
     if (options_.translates_touches() && !event.touches().empty()) {
-      const MouseEvent mouse_event(MouseEvent::Type::DRAGGED,
-                                   event.touches().front(),
-                                   MouseButton::LEFT,
-                                   KeyModifier::NONE);
+      MouseEvent mouse_event(MouseEvent::Type::DRAGGED,
+                             event.touches().front(),
+                             MouseButton::LEFT,
+                             KeyModifier::NONE);
+      mouse_event.set_timestamp(event.timestamp());
       runnable_->mouseDragged(mouse_event, *this);
     }
   }
@@ -264,12 +464,19 @@ inline void Runner::touchesMoved(const TouchEvent& event) {
 
 inline void Runner::touchesCancelled(const TouchEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    if (gesture_recognizer_) {
+      recognizeGestures(event);
+    }
     runnable_->touchesCancelled(event, *this);
     if (options_.translates_touches() && !event.touches().empty()) {
-      const MouseEvent mouse_event(MouseEvent::Type::RELEASED,
-                                   event.touches().front(),
-                                   MouseButton::LEFT,
-                                   KeyModifier::NONE);
+      MouseEvent mouse_event(MouseEvent::Type::RELEASED,
+                             event.touches().front(),
+                             MouseButton::LEFT,
+                             KeyModifier::NONE);
+      mouse_event.set_timestamp(event.timestamp());
       runnable_->mouseReleased(mouse_event, *this);
     }
   }
@@ -277,12 +484,19 @@ inline void Runner::touchesCancelled(const TouchEvent& event) {
 
 inline void Runner::touchesEnded(const TouchEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    if (gesture_recognizer_) {
+      recognizeGestures(event);
+    }
     runnable_->touchesEnded(event, *this);
     if (options_.translates_touches() && !event.touches().empty()) {
-      const MouseEvent mouse_event(MouseEvent::Type::RELEASED,
-                                   event.touches().front(),
-                                   MouseButton::LEFT,
-                                   KeyModifier::NONE);
+      MouseEvent mouse_event(MouseEvent::Type::RELEASED,
+                             event.touches().front(),
+                             MouseButton::LEFT,
+                             KeyModifier::NONE);
+      mouse_event.set_timestamp(event.timestamp());
       runnable_->mouseReleased(mouse_event, *this);
     }
   }
@@ -290,46 +504,283 @@ inline void Runner::touchesEnded(const TouchEvent& event) {
 
 inline void Runner::gestureBegan(const GestureEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->gestureBegan(event, *this);
   }
 }
 
 inline void Runner::gestureChanged(const GestureEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->gestureChanged(event, *this);
   }
 }
 
 inline void Runner::gestureCancelled(const GestureEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->gestureCancelled(event, *this);
   }
 }
 
 inline void Runner::gestureEnded(const GestureEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->gestureEnded(event, *this);
   }
 }
 
 inline void Runner::motionBegan(const MotionEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->motionBegan(event, *this);
   }
 }
 
 inline void Runner::motionCancelled(const MotionEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->motionCancelled(event, *this);
   }
 }
 
 inline void Runner::motionEnded(const MotionEvent& event) {
   if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
     runnable_->motionEnded(event, *this);
   }
 }
 
+inline void Runner::keyPressed(KeyEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    runnable_->keyPressed(std::move(event), *this);
+  }
+}
+
+inline void Runner::keyReleased(KeyEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    runnable_->keyReleased(std::move(event), *this);
+  }
+}
+
+inline void Runner::touchesBegan(TouchEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    if (gesture_recognizer_) {
+      recognizeGestures(event);
+    }
+    const auto translates = (options_.translates_touches() &&
+                             !event.touches().empty());
+    const auto location = translates ? event.touches().front()
+                                     : takram::Vec2d();
+    const auto timestamp = event.timestamp();
+    runnable_->touchesBegan(std::move(event), *this);
+    if (translates) {
+      MouseEvent mouse_event(MouseEvent::Type::PRESSED,
+                             location,
+                             MouseButton::LEFT,
+                             KeyModifier::NONE);
+      mouse_event.set_timestamp(timestamp);
+      runnable_->mousePressed(mouse_event, *this);
+    }
+  }
+}
+
+inline void Runner::touchesMoved(TouchEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    if (gesture_recognizer_) {
+      recognizeGestures(event);
+    }
+    const auto translates = (options_.translates_touches() &&
+                             !event.touches().empty());
+    const auto location = translates ? event.touches().front()
+                                     : takram::Vec2d();
+    const auto timestamp = event.timestamp();
+    runnable_->touchesMoved(std::move(event), *this);
+    if (translates) {
+      MouseEvent mouse_event(MouseEvent::Type::DRAGGED,
+                             location,
+                             MouseButton::LEFT,
+                             KeyModifier::NONE);
+      mouse_event.set_timestamp(timestamp);
+      runnable_->mouseDragged(mouse_event, *this);
+    }
+  }
+}
+
+inline void Runner::touchesCancelled(TouchEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    if (gesture_recognizer_) {
+      recognizeGestures(event);
+    }
+    const auto translates = (options_.translates_touches() &&
+                             !event.touches().empty());
+    const auto location = translates ? event.touches().front()
+                                     : takram::Vec2d();
+    const auto timestamp = event.timestamp();
+    runnable_->touchesCancelled(std::move(event), *this);
+    if (translates) {
+      MouseEvent mouse_event(MouseEvent::Type::RELEASED,
+                             location,
+                             MouseButton::LEFT,
+                             KeyModifier::NONE);
+      mouse_event.set_timestamp(timestamp);
+      runnable_->mouseReleased(mouse_event, *this);
+    }
+  }
+}
+
+inline void Runner::touchesEnded(TouchEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    if (gesture_recognizer_) {
+      recognizeGestures(event);
+    }
+    const auto translates = (options_.translates_touches() &&
+                             !event.touches().empty());
+    const auto location = translates ? event.touches().front()
+                                     : takram::Vec2d();
+    const auto timestamp = event.timestamp();
+    runnable_->touchesEnded(std::move(event), *this);
+    if (translates) {
+      MouseEvent mouse_event(MouseEvent::Type::RELEASED,
+                             location,
+                             MouseButton::LEFT,
+                             KeyModifier::NONE);
+      mouse_event.set_timestamp(timestamp);
+      runnable_->mouseReleased(mouse_event, *this);
+    }
+  }
+}
+
+inline void Runner::gestureBegan(GestureEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    runnable_->gestureBegan(std::move(event), *this);
+  }
+}
+
+inline void Runner::gestureChanged(GestureEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    runnable_->gestureChanged(std::move(event), *this);
+  }
+}
+
+inline void Runner::gestureCancelled(GestureEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    runnable_->gestureCancelled(std::move(event), *this);
+  }
+}
+
+inline void Runner::gestureEnded(GestureEvent&& event) {
+  if (runnable_) {
+    if (recorder_) {
+      recorder_->record(event);
+    }
+    runnable_->gestureEnded(std::move(event), *this);
+  }
+}
+
+#pragma mark Motion samples
+
+inline void Runner::motionSampled(const MotionSample& sample) {
+  if (runnable_) {
+    runnable_->motionSampled(sample, *this);
+  }
+}
+
+#pragma mark Input sources
+
+inline void Runner::addInputSource(InputSource *source) {
+  if (source && std::find(input_sources_.begin(), input_sources_.end(),
+                          source) == input_sources_.end()) {
+    input_sources_.emplace_back(source);
+  }
+}
+
+inline void Runner::removeInputSource(InputSource *source) {
+  input_sources_.erase(std::remove(input_sources_.begin(),
+                                   input_sources_.end(), source),
+                       input_sources_.end());
+}
+
+#pragma mark Recognizing gestures
+
+inline void Runner::recognizeGestures(const TouchEvent& event) {
+  // Gestures go ahead of the touch event that they result from, because the
+  // event may be moved to the runnable. They bypass the recorder, since the
+  // recorded touches give rise to them again when replayed.
+  using Type = GestureEvent::Type;
+  if (!observes(Type::BEGAN) && !observes(Type::CHANGED) &&
+      !observes(Type::CANCELLED) && !observes(Type::ENDED)) {
+    // Skip collecting the touches of gestures when nothing observes them, and
+    // start over once something does, because the recognizer missed the
+    // touches in between.
+    gestures_skipped_ = true;
+    return;
+  }
+  if (gestures_skipped_) {
+    gesture_recognizer_->reset();
+    gestures_skipped_ = false;
+  }
+  gesture_recognizer_->recognize(event, [this](GestureEvent&& gesture) {
+    switch (gesture.type()) {
+      case GestureEvent::Type::BEGAN:
+        runnable_->gestureBegan(std::move(gesture), *this);
+        break;
+      case GestureEvent::Type::CHANGED:
+        runnable_->gestureChanged(std::move(gesture), *this);
+        break;
+      case GestureEvent::Type::CANCELLED:
+        runnable_->gestureCancelled(std::move(gesture), *this);
+        break;
+      case GestureEvent::Type::ENDED:
+        runnable_->gestureEnded(std::move(gesture), *this);
+        break;
+      default:
+        break;
+    }
+  });
+}
+
 }  // namespace solas
 
 #endif  // SOLAS_RUNNER_H_
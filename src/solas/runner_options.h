@@ -28,7 +28,10 @@
 #ifndef SOLAS_RUNNER_OPTIONS_H_
 #define SOLAS_RUNNER_OPTIONS_H_
 
+#include <cstddef>
+
 #include "solas/backend.h"
+#include "solas/event_overflow.h"
 
 namespace solas {
 
@@ -47,11 +50,60 @@ class RunnerOptions final {
   void set_translates_touches(bool value) { translates_touches_ = value; }
   bool dragging_moves_window() const { return dragging_moves_window_; }
   void set_dragging_moves_window(bool value) { dragging_moves_window_ = value; }
+  double update_rate() const { return update_rate_; }
+  void set_update_rate(double value) { update_rate_ = value; }
+  std::size_t max_update_steps() const { return max_update_steps_; }
+  void set_max_update_steps(std::size_t value) { max_update_steps_ = value; }
+  bool pipelined() const { return pipelined_; }
+  void set_pipelined(bool value) { pipelined_ = value; }
+  std::size_t event_queue_capacity() const { return event_queue_capacity_; }
+  void set_event_queue_capacity(std::size_t value) {
+    event_queue_capacity_ = value;
+  }
+  EventOverflow event_overflow() const { return event_overflow_; }
+  void set_event_overflow(EventOverflow value) { event_overflow_ = value; }
+  bool coalesces_events() const { return coalesces_events_; }
+  void set_coalesces_events(bool value) { coalesces_events_ = value; }
+  std::size_t event_drain_limit() const { return event_drain_limit_; }
+  void set_event_drain_limit(std::size_t value) { event_drain_limit_ = value; }
+  double event_drain_duration() const { return event_drain_duration_; }
+  void set_event_drain_duration(double value) { event_drain_duration_ = value; }
+  std::size_t event_drain_minimum() const { return event_drain_minimum_; }
+  void set_event_drain_minimum(std::size_t value) {
+    event_drain_minimum_ = value;
+  }
+  bool traces_latency() const { return traces_latency_; }
+  void set_traces_latency(bool value) { traces_latency_ = value; }
+  double input_prediction() const { return input_prediction_; }
+  void set_input_prediction(double value) { input_prediction_ = value; }
+  double input_extrapolation() const { return input_extrapolation_; }
+  void set_input_extrapolation(double value) { input_extrapolation_ = value; }
+  bool recognizes_gestures() const { return recognizes_gestures_; }
+  void set_recognizes_gestures(bool value) { recognizes_gestures_ = value; }
+  std::size_t motion_capacity() const { return motion_capacity_; }
+  void set_motion_capacity(std::size_t value) { motion_capacity_ = value; }
+  std::size_t motion_window() const { return motion_window_; }
+  void set_motion_window(std::size_t value) { motion_window_ = value; }
 
  private:
   Backend backend_;
   bool translates_touches_;
   bool dragging_moves_window_;
+  double update_rate_;
+  std::size_t max_update_steps_;
+  bool pipelined_;
+  std::size_t event_queue_capacity_;
+  EventOverflow event_overflow_;
+  bool coalesces_events_;
+  std::size_t event_drain_limit_;
+  double event_drain_duration_;
+  std::size_t event_drain_minimum_;
+  bool traces_latency_;
+  double input_prediction_;
+  double input_extrapolation_;
+  bool recognizes_gestures_;
+  std::size_t motion_capacity_;
+  std::size_t motion_window_;
 };
 
 // Comparison
@@ -63,14 +115,44 @@ bool operator!=(const RunnerOptions& lhs, const RunnerOptions& rhs);
 inline RunnerOptions::RunnerOptions()
     : backend_(Backend::OPENGL2 | Backend::OPENGLES2),
       translates_touches_(true),
-      dragging_moves_window_(false) {}
+      dragging_moves_window_(false),
+      update_rate_(),
+      max_update_steps_(5),
+      pipelined_(false),
+      event_queue_capacity_(1024),
+      event_overflow_(EventOverflow::DROP_OLDEST),
+      coalesces_events_(false),
+      event_drain_limit_(),
+      event_drain_duration_(),
+      event_drain_minimum_(16),
+      traces_latency_(false),
+      input_prediction_(),
+      input_extrapolation_(0.008),
+      recognizes_gestures_(false),
+      motion_capacity_(1024),
+      motion_window_(256) {}
 
 #pragma mark Comparison
 
 inline bool operator==(const RunnerOptions& lhs, const RunnerOptions& rhs) {
   return (lhs.backend() == rhs.backend() &&
           lhs.translates_touches() == rhs.translates_touches() &&
-          lhs.dragging_moves_window() == rhs.dragging_moves_window());
+          lhs.dragging_moves_window() == rhs.dragging_moves_window() &&
+          lhs.update_rate() == rhs.update_rate() &&
+          lhs.max_update_steps() == rhs.max_update_steps() &&
+          lhs.pipelined() == rhs.pipelined() &&
+          lhs.event_queue_capacity() == rhs.event_queue_capacity() &&
+          lhs.event_overflow() == rhs.event_overflow() &&
+          lhs.coalesces_events() == rhs.coalesces_events() &&
+          lhs.event_drain_limit() == rhs.event_drain_limit() &&
+          lhs.event_drain_duration() == rhs.event_drain_duration() &&
+          lhs.event_drain_minimum() == rhs.event_drain_minimum() &&
+          lhs.traces_latency() == rhs.traces_latency() &&
+          lhs.input_prediction() == rhs.input_prediction() &&
+          lhs.input_extrapolation() == rhs.input_extrapolation() &&
+          lhs.recognizes_gestures() == rhs.recognizes_gestures() &&
+          lhs.motion_capacity() == rhs.motion_capacity() &&
+          lhs.motion_window() == rhs.motion_window());
 }
 
 inline bool operator!=(const RunnerOptions& lhs, const RunnerOptions& rhs) {
@@ -0,0 +1,155 @@
+//
+//  solas/runner_scheduler.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/runner_scheduler.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "solas/run.h"
+#include "solas/runner.h"
+
+namespace solas {
+
+RunnerScheduler::RunnerScheduler()
+    : RunnerScheduler(std::max(std::thread::hardware_concurrency(), 1u)) {}
+
+RunnerScheduler::RunnerScheduler(std::size_t threads)
+    : stopping_(false) {
+  threads_.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i) {
+    threads_.emplace_back(&RunnerScheduler::run, this);
+  }
+}
+
+RunnerScheduler::~RunnerScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  task_condition_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+#pragma mark Shared instance
+
+RunnerScheduler& RunnerScheduler::shared() {
+  static RunnerScheduler instance;
+  return instance;
+}
+
+#pragma mark Scheduling tasks
+
+void RunnerScheduler::dispatch(std::function<void()>&& task) {
+  dispatch(std::move(task), &latch_);
+}
+
+void RunnerScheduler::wait() {
+  wait(&latch_);
+}
+
+void RunnerScheduler::dispatch(std::function<void()>&& task, Latch *latch) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(Task{std::move(task), latch});
+    ++latch->count;
+  }
+  task_condition_.notify_one();
+}
+
+void RunnerScheduler::wait(Latch *latch) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (latch->count) {
+    // Help out with the remaining tasks instead of blocking the caller,
+    // which is usually the thread that drives the frames.
+    if (!perform(lock)) {
+      done_condition_.wait(lock);
+    }
+  }
+  if (latch->exception) {
+    std::rethrow_exception(std::exchange(latch->exception, nullptr));
+  }
+}
+
+void RunnerScheduler::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    task_condition_.wait(lock, [this] {
+      return !tasks_.empty() || stopping_;
+    });
+    if (tasks_.empty()) {
+      break;
+    }
+    perform(lock);
+  }
+}
+
+bool RunnerScheduler::perform(std::unique_lock<std::mutex>& lock) {
+  if (tasks_.empty()) {
+    return false;
+  }
+  auto task = std::move(tasks_.front());
+  tasks_.pop_front();
+  lock.unlock();
+  std::exception_ptr exception;
+  try {
+    task.function();
+  } catch (...) {
+    // The waiter of the task rethrows it, and the task still completes so
+    // that the waiter doesn't wait forever.
+    exception = std::current_exception();
+  }
+  lock.lock();
+  if (exception && !task.latch->exception) {
+    task.latch->exception = exception;
+  }
+  if (!--task.latch->count) {
+    done_condition_.notify_all();
+  }
+  return true;
+}
+
+#pragma mark Creating runners
+
+std::vector<std::unique_ptr<Runner>> RunnerScheduler::create(
+    std::size_t count) {
+  std::vector<std::unique_ptr<Runner>> runners(count);
+  apply(runners.begin(), runners.end(), [](std::unique_ptr<Runner>& runner) {
+    runner = Run::instance().create();
+  });
+  return runners;
+}
+
+}  // namespace solas
@@ -0,0 +1,114 @@
+//
+//  solas/runner_scheduler.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_RUNNER_SCHEDULER_H_
+#define SOLAS_RUNNER_SCHEDULER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "solas/runner.h"
+
+namespace solas {
+
+class RunnerScheduler final {
+ public:
+  RunnerScheduler();
+  explicit RunnerScheduler(std::size_t threads);
+  ~RunnerScheduler();
+
+  // Disallow copy semantics
+  RunnerScheduler(const RunnerScheduler&) = delete;
+  RunnerScheduler& operator=(const RunnerScheduler&) = delete;
+
+  // Shared instance
+  static RunnerScheduler& shared();
+
+  // Scheduling tasks
+  void dispatch(std::function<void()>&& task);
+  void wait();
+  template <class Iterator, class Function>
+  void apply(Iterator first, Iterator last, Function function);
+
+  // Creating runners
+  std::vector<std::unique_ptr<Runner>> create(std::size_t count);
+
+  // Properties
+  std::size_t threads() const { return threads_.size(); }
+
+ private:
+  // Tasks left to complete and the first exception thrown by them, which
+  // each application of a function counts separately from the others
+  struct Latch {
+    std::size_t count = 0;
+    std::exception_ptr exception;
+  };
+
+  struct Task {
+    std::function<void()> function;
+    Latch *latch;
+  };
+
+  void dispatch(std::function<void()>&& task, Latch *latch);
+  void wait(Latch *latch);
+  void run();
+  bool perform(std::unique_lock<std::mutex>& lock);
+
+ private:
+  std::deque<Task> tasks_;
+  Latch latch_;
+  bool stopping_;
+  std::mutex mutex_;
+  std::condition_variable task_condition_;
+  std::condition_variable done_condition_;
+  std::vector<std::thread> threads_;
+};
+
+#pragma mark -
+
+template <class Iterator, class Function>
+inline void RunnerScheduler::apply(Iterator first,
+                                   Iterator last,
+                                   Function function) {
+  Latch latch;
+  for (; first != last; ++first) {
+    auto& element = *first;
+    dispatch([&element, &function] { function(element); }, &latch);
+  }
+  wait(&latch);
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_RUNNER_SCHEDULER_H_
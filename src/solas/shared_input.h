@@ -0,0 +1,109 @@
+//
+//  solas/shared_input.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_SHARED_INPUT_H_
+#define SOLAS_SHARED_INPUT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace solas {
+
+// Layout of the single-producer single-consumer ring that another process
+// writes input records into through shared memory, and of recorded event
+// logs. An event is one record followed by as many point records as its
+// count, which the writer publishes all at once, so that the reader never
+// sees a partial event. Logs also mark the end of input of each frame.
+struct SharedInputRecord {
+  enum class Kind : std::uint8_t {
+    UNDEFINED,
+    MOUSE,
+    KEY,
+    TOUCH,
+    GESTURE,
+    POINT,
+    MOTION,
+    FRAME
+  };
+
+  Kind kind;
+  std::uint8_t type;
+  std::uint16_t count;
+
+  // Key code, mouse button, gesture kind, motion kind or touch phase
+  std::uint32_t code;
+
+  // Key modifiers of mouse and key events, or the upper half of the touch
+  // identifier of a point, which is as wide as a pointer on some platforms
+  std::uint32_t modifiers;
+
+  // Lower half of the touch identifier of a point, or length of the
+  // characters of a key event
+  std::uint32_t identifier;
+
+  // Nanoseconds of the steady clock, which is shared by processes
+  std::int64_t timestamp;
+
+  // Location and wheel, gesture data, or characters of a key event
+  double values[5];
+};
+
+static_assert(sizeof(SharedInputRecord) == 64,
+              "Shared input records must be 64 bytes");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2,
+              "Shared input requires lock-free 64-bit atomics");
+
+struct SharedInputHeader {
+  static constexpr std::uint32_t magic_number = 0x534f4c49;  // SOLI
+  static constexpr std::uint32_t version_number = 1;
+
+  std::uint32_t magic;
+  std::uint32_t version;
+  std::uint64_t capacity;
+
+  // The writer and reader only modify their own index, each on a cache line
+  // of its own.
+  alignas(64) std::atomic<std::uint64_t> tail;
+  std::atomic<std::uint64_t> dropped;
+  alignas(64) std::atomic<std::uint64_t> head;
+
+  // Records of the capacity follow the header
+  SharedInputRecord * records() {
+    return reinterpret_cast<SharedInputRecord *>(this + 1);
+  }
+  static std::size_t size(std::size_t capacity) {
+    return sizeof(SharedInputHeader) + capacity * sizeof(SharedInputRecord);
+  }
+};
+
+static_assert(sizeof(SharedInputHeader) % 64 == 0,
+              "Shared input header must be aligned to cache lines");
+
+}  // namespace solas
+
+#endif  // SOLAS_SHARED_INPUT_H_
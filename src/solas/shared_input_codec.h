@@ -0,0 +1,541 @@
+//
+//  solas/shared_input_codec.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_SHARED_INPUT_CODEC_H_
+#define SOLAS_SHARED_INPUT_CODEC_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "solas/gesture_event.h"
+#include "solas/gesture_kind.h"
+#include "solas/key_event.h"
+#include "solas/key_modifier.h"
+#include "solas/motion_event.h"
+#include "solas/motion_kind.h"
+#include "solas/mouse_button.h"
+#include "solas/mouse_event.h"
+#include "solas/payload_pool.h"
+#include "solas/runner.h"
+#include "solas/screen_edge.h"
+#include "solas/shared_input.h"
+#include "solas/swipe_direction.h"
+#include "solas/touch_event.h"
+#include "takram/math.h"
+
+namespace solas {
+
+// Converts events to and from shared input records. Records are accessed
+// through a function that takes the index of a record relative to the first
+// one of an event, so that they can wrap around the end of a ring.
+class SharedInputCodec final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  SharedInputCodec() = delete;
+
+  // Number of records
+  static std::size_t size(const MouseEvent& event) { return 1; }
+  static std::size_t size(const KeyEvent& event) { return 1; }
+  static std::size_t size(const TouchEvent& event);
+  static std::size_t size(const GestureEvent& event);
+  static std::size_t size(const MotionEvent& event) { return 1; }
+
+  // Encoding
+  template <class Records>
+  static void encode(const MouseEvent& event, Records&& records);
+  template <class Records>
+  static void encode(const KeyEvent& event, Records&& records);
+  template <class Records>
+  static void encode(const TouchEvent& event, Records&& records);
+  template <class Records>
+  static void encode(const GestureEvent& event, Records&& records);
+  template <class Records>
+  static void encode(const MotionEvent& event, Records&& records);
+
+  // Decoding into the runner, shifting timestamps by the offset
+  template <class Records>
+  static void dispatch(Runner& runner,
+                       Records&& records,
+                       Clock::duration offset = Clock::duration::zero());
+
+  // Timestamps
+  static std::int64_t timestamp(Clock::time_point time);
+  static Clock::time_point time_point(std::int64_t timestamp);
+
+ private:
+  // Encoding
+  static std::size_t points(std::size_t size);
+  static SharedInputRecord& head(SharedInputRecord& record,
+                                 SharedInputRecord::Kind kind,
+                                 std::uint8_t type,
+                                 std::size_t count,
+                                 Clock::time_point time);
+  template <class Records>
+  static void encodePoints(const std::vector<takram::Vec2d>& touches,
+                           Records&& records);
+
+  // Decoding
+  template <class Records>
+  static void dispatchMouse(Runner& runner,
+                            Records&& records,
+                            Clock::duration offset);
+  template <class Records>
+  static void dispatchKey(Runner& runner,
+                          Records&& records,
+                          Clock::duration offset);
+  template <class Records>
+  static void dispatchTouch(Runner& runner,
+                            Records&& records,
+                            Clock::duration offset);
+  template <class Records>
+  static void dispatchGesture(Runner& runner,
+                              Records&& records,
+                              Clock::duration offset);
+  template <class Records>
+  static void dispatchMotion(Runner& runner,
+                             Records&& records,
+                             Clock::duration offset);
+};
+
+#pragma mark -
+
+#pragma mark Number of records
+
+inline std::size_t SharedInputCodec::size(const TouchEvent& event) {
+  return points(event.touches().size()) + 1;
+}
+
+inline std::size_t SharedInputCodec::size(const GestureEvent& event) {
+  return points(event.touches().size()) + 1;
+}
+
+inline std::size_t SharedInputCodec::points(std::size_t size) {
+  return std::min<std::size_t>(
+      size, std::numeric_limits<std::uint16_t>::max());
+}
+
+#pragma mark Timestamps
+
+inline std::int64_t SharedInputCodec::timestamp(Clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      time.time_since_epoch()).count();
+}
+
+inline SharedInputCodec::Clock::time_point SharedInputCodec::time_point(
+    std::int64_t timestamp) {
+  return Clock::time_point(std::chrono::duration_cast<Clock::duration>(
+      std::chrono::nanoseconds(timestamp)));
+}
+
+#pragma mark Encoding
+
+inline SharedInputRecord& SharedInputCodec::head(
+    SharedInputRecord& record,
+    SharedInputRecord::Kind kind,
+    std::uint8_t type,
+    std::size_t count,
+    Clock::time_point time) {
+  record.kind = kind;
+  record.type = type;
+  record.count = count;
+  record.code = 0;
+  record.modifiers = 0;
+  record.identifier = 0;
+  record.timestamp = timestamp(time);
+  std::fill(std::begin(record.values), std::end(record.values), 0.0);
+  return record;
+}
+
+template <class Records>
+inline void SharedInputCodec::encode(const MouseEvent& event,
+                                     Records&& records) {
+  auto& record = head(records(0),
+                      SharedInputRecord::Kind::MOUSE,
+                      static_cast<std::uint8_t>(event.type()),
+                      0, event.timestamp());
+  record.code = static_cast<std::uint32_t>(event.button());
+  record.modifiers = static_cast<std::uint32_t>(event.modifiers());
+  record.values[0] = event.location().x;
+  record.values[1] = event.location().y;
+  record.values[2] = event.wheel().x;
+  record.values[3] = event.wheel().y;
+  record.values[4] = event.wheel().z;
+}
+
+template <class Records>
+inline void SharedInputCodec::encode(const KeyEvent& event,
+                                     Records&& records) {
+  auto& record = head(records(0),
+                      SharedInputRecord::Kind::KEY,
+                      static_cast<std::uint8_t>(event.type()),
+                      0, event.timestamp());
+  // Characters that don't fit in the values are truncated
+  const auto& characters = event.characters();
+  const auto length = std::min(characters.size(), sizeof(record.values));
+  record.code = event.code();
+  record.modifiers = static_cast<std::uint32_t>(event.modifiers());
+  record.identifier = static_cast<std::uint32_t>(length);
+  std::memcpy(record.values, characters.data(), length);
+}
+
+template <class Records>
+inline void SharedInputCodec::encode(const TouchEvent& event,
+                                     Records&& records) {
+  const auto& contacts = event.contacts();
+  const auto count = points(event.touches().size());
+  auto& record = head(records(0),
+                      SharedInputRecord::Kind::TOUCH,
+                      static_cast<std::uint8_t>(event.type()),
+                      count, event.timestamp());
+  record.code = !contacts.empty();
+  encodePoints(event.touches(), records);
+  for (std::size_t i = 0; i < count && i < contacts.size(); ++i) {
+    auto& point = records(i + 1);
+    point.code = static_cast<std::uint32_t>(contacts[i].phase);
+    const auto identifier = static_cast<std::uint64_t>(
+        contacts[i].identifier);
+    point.modifiers = static_cast<std::uint32_t>(identifier >> 32);
+    point.identifier = static_cast<std::uint32_t>(identifier);
+  }
+}
+
+template <class Records>
+inline void SharedInputCodec::encode(const GestureEvent& event,
+                                     Records&& records) {
+  auto& record = head(records(0),
+                      SharedInputRecord::Kind::GESTURE,
+                      static_cast<std::uint8_t>(event.type()),
+                      points(event.touches().size()), event.timestamp());
+  record.code = static_cast<std::uint32_t>(event.kind());
+  switch (event.kind()) {
+    case GestureKind::TAP:
+      record.values[0] = event.tap().taps;
+      record.values[1] = event.tap().touches;
+      break;
+    case GestureKind::PINCH:
+      record.values[0] = event.pinch().scale;
+      record.values[1] = event.pinch().velocity;
+      break;
+    case GestureKind::ROTATION:
+      record.values[0] = event.rotation().rotation;
+      record.values[1] = event.rotation().velocity;
+      break;
+    case GestureKind::SWIPE:
+      record.values[0] = static_cast<int>(event.swipe().direction);
+      record.values[1] = event.swipe().touches;
+      break;
+    case GestureKind::PAN:
+      record.values[0] = event.pan().translation.x;
+      record.values[1] = event.pan().translation.y;
+      record.values[2] = event.pan().velocity.x;
+      record.values[3] = event.pan().velocity.y;
+      record.values[4] = event.pan().touches;
+      break;
+    case GestureKind::SCREEN_EDGE:
+      record.values[0] = static_cast<int>(event.screen_edge().edge);
+      break;
+    default:
+      break;
+  }
+  encodePoints(event.touches(), records);
+}
+
+template <class Records>
+inline void SharedInputCodec::encode(const MotionEvent& event,
+                                     Records&& records) {
+  auto& record = head(records(0),
+                      SharedInputRecord::Kind::MOTION,
+                      static_cast<std::uint8_t>(event.type()),
+                      0, event.timestamp());
+  record.code = static_cast<std::uint32_t>(event.kind());
+}
+
+template <class Records>
+inline void SharedInputCodec::encodePoints(
+    const std::vector<takram::Vec2d>& touches,
+    Records&& records) {
+  const auto count = points(touches.size());
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& point = records(i + 1);
+    point.kind = SharedInputRecord::Kind::POINT;
+    point.type = 0;
+    point.count = 0;
+    point.code = 0;
+    point.modifiers = 0;
+    point.identifier = 0;
+    point.timestamp = 0;
+    std::fill(std::begin(point.values), std::end(point.values), 0.0);
+    point.values[0] = touches[i].x;
+    point.values[1] = touches[i].y;
+  }
+}
+
+#pragma mark Decoding
+
+template <class Records>
+inline void SharedInputCodec::dispatch(Runner& runner,
+                                       Records&& records,
+                                       Clock::duration offset) {
+  switch (records(0).kind) {
+    case SharedInputRecord::Kind::MOUSE:
+      dispatchMouse(runner, records, offset);
+      break;
+    case SharedInputRecord::Kind::KEY:
+      dispatchKey(runner, records, offset);
+      break;
+    case SharedInputRecord::Kind::TOUCH:
+      dispatchTouch(runner, records, offset);
+      break;
+    case SharedInputRecord::Kind::GESTURE:
+      dispatchGesture(runner, records, offset);
+      break;
+    case SharedInputRecord::Kind::MOTION:
+      dispatchMotion(runner, records, offset);
+      break;
+    default:
+      break;
+  }
+}
+
+template <class Records>
+inline void SharedInputCodec::dispatchMouse(Runner& runner,
+                                            Records&& records,
+                                            Clock::duration offset) {
+  const auto& record = records(0);
+  MouseEvent event(static_cast<MouseEvent::Type>(record.type),
+                   takram::Vec2d(record.values[0], record.values[1]),
+                   static_cast<MouseButton>(record.code),
+                   static_cast<KeyModifier>(record.modifiers),
+                   takram::Vec3d(record.values[2],
+                                 record.values[3],
+                                 record.values[4]));
+  event.set_timestamp(time_point(record.timestamp) + offset);
+  switch (event.type()) {
+    case MouseEvent::Type::PRESSED:
+      runner.mousePressed(event);
+      break;
+    case MouseEvent::Type::DRAGGED:
+      runner.mouseDragged(event);
+      break;
+    case MouseEvent::Type::RELEASED:
+      runner.mouseReleased(event);
+      break;
+    case MouseEvent::Type::MOVED:
+      runner.mouseMoved(event);
+      break;
+    case MouseEvent::Type::ENTERED:
+      runner.mouseEntered(event);
+      break;
+    case MouseEvent::Type::EXITED:
+      runner.mouseExited(event);
+      break;
+    case MouseEvent::Type::WHEEL:
+      runner.mouseWheel(event);
+      break;
+    default:
+      break;
+  }
+}
+
+template <class Records>
+inline void SharedInputCodec::dispatchKey(Runner& runner,
+                                          Records&& records,
+                                          Clock::duration offset) {
+  const auto& record = records(0);
+  const auto length = std::min<std::size_t>(record.identifier,
+                                            sizeof(record.values));
+  auto characters = PayloadPool::shared().characters();
+  characters.assign(reinterpret_cast<const char *>(record.values), length);
+  KeyEvent event(static_cast<KeyEvent::Type>(record.type),
+                 record.code,
+                 std::move(characters),
+                 static_cast<KeyModifier>(record.modifiers));
+  event.set_timestamp(time_point(record.timestamp) + offset);
+  switch (event.type()) {
+    case KeyEvent::Type::PRESSED:
+      runner.keyPressed(std::move(event));
+      break;
+    case KeyEvent::Type::RELEASED:
+      runner.keyReleased(std::move(event));
+      break;
+    default:
+      break;
+  }
+}
+
+template <class Records>
+inline void SharedInputCodec::dispatchTouch(Runner& runner,
+                                            Records&& records,
+                                            Clock::duration offset) {
+  const auto& record = records(0);
+  auto touches = PayloadPool::shared().touches();
+  auto contacts = PayloadPool::shared().contacts();
+  for (std::size_t i = 1; i <= record.count; ++i) {
+    const auto& point = records(i);
+    touches.emplace_back(point.values[0], point.values[1]);
+    if (record.code) {
+      const auto identifier = (std::uint64_t(point.modifiers) << 32 |
+                               point.identifier);
+      contacts.push_back({
+        static_cast<std::uintptr_t>(identifier),
+        static_cast<TouchEvent::Type>(point.code)
+      });
+    }
+  }
+  TouchEvent event(static_cast<TouchEvent::Type>(record.type),
+                   std::move(touches),
+                   std::move(contacts));
+  event.set_timestamp(time_point(record.timestamp) + offset);
+  switch (event.type()) {
+    case TouchEvent::Type::BEGAN:
+      runner.touchesBegan(std::move(event));
+      break;
+    case TouchEvent::Type::MOVED:
+      runner.touchesMoved(std::move(event));
+      break;
+    case TouchEvent::Type::CANCELLED:
+      runner.touchesCancelled(std::move(event));
+      break;
+    case TouchEvent::Type::ENDED:
+      runner.touchesEnded(std::move(event));
+      break;
+    default:
+      break;
+  }
+}
+
+template <class Records>
+inline void SharedInputCodec::dispatchGesture(Runner& runner,
+                                              Records&& records,
+                                              Clock::duration offset) {
+  const auto& record = records(0);
+  auto touches = PayloadPool::shared().touches();
+  for (std::size_t i = 1; i <= record.count; ++i) {
+    const auto& point = records(i);
+    touches.emplace_back(point.values[0], point.values[1]);
+  }
+  const auto type = static_cast<GestureEvent::Type>(record.type);
+  const auto kind = static_cast<GestureKind>(record.code);
+  const auto values = record.values;
+  boost::optional<GestureEvent> event;
+  switch (kind) {
+    case GestureKind::TAP:
+      event.emplace(type, kind, std::move(touches),
+                    GestureEvent::TapData{
+                      static_cast<std::size_t>(values[0]),
+                      static_cast<std::size_t>(values[1])
+                    });
+      break;
+    case GestureKind::PINCH:
+      event.emplace(type, kind, std::move(touches),
+                    GestureEvent::PinchData{values[0], values[1]});
+      break;
+    case GestureKind::ROTATION:
+      event.emplace(type, kind, std::move(touches),
+                    GestureEvent::RotationData{values[0], values[1]});
+      break;
+    case GestureKind::SWIPE:
+      event.emplace(type, kind, std::move(touches),
+                    GestureEvent::SwipeData{
+                      static_cast<SwipeDirection>(values[0]),
+                      static_cast<std::size_t>(values[1])
+                    });
+      break;
+    case GestureKind::PAN:
+      event.emplace(type, kind, std::move(touches),
+                    GestureEvent::PanData{
+                      takram::Vec2d(values[0], values[1]),
+                      takram::Vec2d(values[2], values[3]),
+                      static_cast<std::size_t>(values[4])
+                    });
+      break;
+    case GestureKind::SCREEN_EDGE:
+      event.emplace(type, kind, std::move(touches),
+                    GestureEvent::ScreenEdgeData{
+                      static_cast<ScreenEdge>(values[0])
+                    });
+      break;
+    default:
+      PayloadPool::shared().recycle(std::move(touches));
+      return;
+  }
+  event->set_timestamp(time_point(record.timestamp) + offset);
+  switch (type) {
+    case GestureEvent::Type::BEGAN:
+      runner.gestureBegan(std::move(*event));
+      break;
+    case GestureEvent::Type::CHANGED:
+      runner.gestureChanged(std::move(*event));
+      break;
+    case GestureEvent::Type::CANCELLED:
+      runner.gestureCancelled(std::move(*event));
+      break;
+    case GestureEvent::Type::ENDED:
+      runner.gestureEnded(std::move(*event));
+      break;
+    default:
+      break;
+  }
+}
+
+template <class Records>
+inline void SharedInputCodec::dispatchMotion(Runner& runner,
+                                             Records&& records,
+                                             Clock::duration offset) {
+  const auto& record = records(0);
+  MotionEvent event(static_cast<MotionEvent::Type>(record.type),
+                    static_cast<MotionKind>(record.code));
+  event.set_timestamp(time_point(record.timestamp) + offset);
+  switch (event.type()) {
+    case MotionEvent::Type::BEGAN:
+      runner.motionBegan(event);
+      break;
+    case MotionEvent::Type::CANCELLED:
+      runner.motionCancelled(event);
+      break;
+    case MotionEvent::Type::ENDED:
+      runner.motionEnded(event);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_SHARED_INPUT_CODEC_H_
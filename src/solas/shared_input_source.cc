@@ -0,0 +1,139 @@
+//
+//  solas/shared_input_source.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/shared_input_source.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+
+#include "solas/runner.h"
+#include "solas/shared_input.h"
+#include "solas/shared_input_codec.h"
+
+namespace solas {
+
+SharedInputSource::SharedInputSource()
+    : header_(),
+      capacity_(),
+      mask_() {}
+
+#pragma mark Opening the ring
+
+bool SharedInputSource::open(const std::string& name, std::size_t capacity) {
+  close();
+  // Round the capacity up to a power of two to index records by masking
+  std::size_t size = 2;
+  while (size < capacity) {
+    size <<= 1;
+  }
+  if (!memory_.create(name, SharedInputHeader::size(size))) {
+    return false;
+  }
+  header_ = new (memory_.data()) SharedInputHeader();
+  header_->version = SharedInputHeader::version_number;
+  header_->capacity = size;
+  header_->tail.store(0, std::memory_order_relaxed);
+  header_->dropped.store(0, std::memory_order_relaxed);
+  header_->head.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  header_->magic = SharedInputHeader::magic_number;
+  capacity_ = size;
+  mask_ = size - 1;
+  return true;
+}
+
+void SharedInputSource::close() {
+  header_ = nullptr;
+  capacity_ = 0;
+  mask_ = 0;
+  memory_.close();
+}
+
+#pragma mark Polling events
+
+void SharedInputSource::poll(Runner& runner) {
+  if (!header_) {
+    return;
+  }
+  // Only read records that were published by the time of this poll, and let
+  // the writer reuse their space all at once afterwards. Events beyond half
+  // the capacity of the event queue stay in the ring for the next frame,
+  // leaving room for platform events and touches translated into mouse
+  // events, so that the writer sees the back pressure instead of the queue
+  // dropping events.
+  auto head = header_->head.load(std::memory_order_relaxed);
+  const auto tail = header_->tail.load(std::memory_order_acquire);
+  if (tail > head && tail - head > capacity_) {
+    // More records than the ring holds can't have been written intact
+    header_->head.store(tail, std::memory_order_release);
+    return;
+  }
+  const auto limit = std::max<std::size_t>(
+      runner.options().event_queue_capacity() / 2, 1);
+  for (std::size_t events = 0; head < tail && events < limit; ++events) {
+    const auto& first = record(head);
+    const std::uint64_t count = first.count + 1;
+    if (first.kind == SharedInputRecord::Kind::POINT || count > tail - head) {
+      // The writer broke the layout, so discard everything available
+      head = tail;
+      break;
+    }
+    dispatch(runner, head);
+    head += count;
+  }
+  header_->head.store(head, std::memory_order_release);
+}
+
+#pragma mark Properties
+
+std::uint64_t SharedInputSource::dropped() const {
+  if (!header_) {
+    return 0;
+  }
+  return header_->dropped.load(std::memory_order_relaxed);
+}
+
+#pragma mark Reading records
+
+const SharedInputRecord& SharedInputSource::record(
+    std::uint64_t index) const {
+  // The capacity in the header is never read again after opening, so that a
+  // writer changing it can't make this process read past the mapping.
+  return header_->records()[index & mask_];
+}
+
+void SharedInputSource::dispatch(Runner& runner, std::uint64_t index) {
+  SharedInputCodec::dispatch(runner, [this, index](std::size_t offset)
+      -> const SharedInputRecord& {
+    return record(index + offset);
+  });
+}
+
+}  // namespace solas
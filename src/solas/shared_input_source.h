@@ -0,0 +1,85 @@
+//
+//  solas/shared_input_source.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_SHARED_INPUT_SOURCE_H_
+#define SOLAS_SHARED_INPUT_SOURCE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "solas/input_source.h"
+#include "solas/shared_input.h"
+#include "solas/shared_memory.h"
+
+namespace solas {
+
+class Runner;
+
+// Reads events that another process writes through a shared input writer,
+// such as a driver of an external sensor, and passes them to the runner all
+// at once every frame. The source creates the shared memory of the given
+// name, which is removed when the source closes. Opening fails if the name
+// exists; SharedMemory::remove() replaces memory that a crashed source left.
+class SharedInputSource final : public InputSource {
+ public:
+  static constexpr std::size_t default_capacity = 4096;
+
+ public:
+  SharedInputSource();
+
+  // Opening the ring
+  bool open(const std::string& name,
+            std::size_t capacity = default_capacity);
+  void close();
+  bool is_open() const { return header_; }
+
+  // Polling events
+  void poll(Runner& runner) override;
+
+  // Properties
+  const std::string& name() const { return memory_.name(); }
+  std::size_t capacity() const { return capacity_; }
+  std::uint64_t dropped() const;
+
+ private:
+  // Reading records
+  const SharedInputRecord& record(std::uint64_t index) const;
+  void dispatch(Runner& runner, std::uint64_t index);
+
+ private:
+  SharedMemory memory_;
+  SharedInputHeader *header_;
+
+  // Kept apart from the header, which the writer can overwrite
+  std::size_t capacity_;
+  std::size_t mask_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_SHARED_INPUT_SOURCE_H_
@@ -0,0 +1,151 @@
+//
+//  solas/shared_input_writer.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/shared_input_writer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "solas/gesture_event.h"
+#include "solas/key_event.h"
+#include "solas/motion_event.h"
+#include "solas/mouse_event.h"
+#include "solas/shared_input.h"
+#include "solas/shared_input_codec.h"
+#include "solas/touch_event.h"
+
+namespace solas {
+
+SharedInputWriter::SharedInputWriter() : header_(), tail_(), head_() {}
+
+#pragma mark Opening the ring
+
+bool SharedInputWriter::open(const std::string& name) {
+  close();
+  if (!memory_.open(name)) {
+    return false;
+  }
+  const auto header = static_cast<SharedInputHeader *>(memory_.data());
+  if (memory_.size() < sizeof(SharedInputHeader) ||
+      header->magic != SharedInputHeader::magic_number ||
+      header->version != SharedInputHeader::version_number ||
+      memory_.size() < SharedInputHeader::size(header->capacity)) {
+    memory_.close();
+    return false;
+  }
+  header_ = header;
+  tail_ = header_->tail.load(std::memory_order_relaxed);
+  head_ = header_->head.load(std::memory_order_acquire);
+  return true;
+}
+
+void SharedInputWriter::close() {
+  header_ = nullptr;
+  memory_.close();
+}
+
+#pragma mark Writing events
+
+bool SharedInputWriter::write(const MouseEvent& event) {
+  return encode<MouseEvent>(event);
+}
+
+bool SharedInputWriter::write(const KeyEvent& event) {
+  return encode<KeyEvent>(event);
+}
+
+bool SharedInputWriter::write(const TouchEvent& event) {
+  return encode<TouchEvent>(event);
+}
+
+bool SharedInputWriter::write(const GestureEvent& event) {
+  return encode<GestureEvent>(event);
+}
+
+bool SharedInputWriter::write(const MotionEvent& event) {
+  return encode<MotionEvent>(event);
+}
+
+template <class Event>
+bool SharedInputWriter::encode(const Event& event) {
+  const auto size = SharedInputCodec::size(event);
+  if (!reserve(size)) {
+    return false;
+  }
+  SharedInputCodec::encode(event, [this](std::size_t index) -> auto& {
+    return record(index);
+  });
+  publish(size);
+  return true;
+}
+
+#pragma mark Properties
+
+std::size_t SharedInputWriter::capacity() const {
+  if (!header_) {
+    return 0;
+  }
+  return header_->capacity;
+}
+
+std::uint64_t SharedInputWriter::dropped() const {
+  if (!header_) {
+    return 0;
+  }
+  return header_->dropped.load(std::memory_order_relaxed);
+}
+
+#pragma mark Managing the ring
+
+bool SharedInputWriter::reserve(std::size_t count) {
+  if (!header_) {
+    return false;
+  }
+  // Read the reader's index only when the cached one says the ring is full
+  const auto capacity = header_->capacity;
+  if (tail_ + count - head_ > capacity) {
+    head_ = header_->head.load(std::memory_order_acquire);
+    if (tail_ + count - head_ > capacity) {
+      header_->dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  }
+  return true;
+}
+
+SharedInputRecord& SharedInputWriter::record(std::size_t index) {
+  const auto mask = header_->capacity - 1;
+  return header_->records()[(tail_ + index) & mask];
+}
+
+void SharedInputWriter::publish(std::size_t count) {
+  tail_ += count;
+  header_->tail.store(tail_, std::memory_order_release);
+}
+
+}  // namespace solas
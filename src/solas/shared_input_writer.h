@@ -0,0 +1,91 @@
+//
+//  solas/shared_input_writer.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_SHARED_INPUT_WRITER_H_
+#define SOLAS_SHARED_INPUT_WRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "solas/gesture_event.h"
+#include "solas/key_event.h"
+#include "solas/motion_event.h"
+#include "solas/mouse_event.h"
+#include "solas/shared_input.h"
+#include "solas/shared_memory.h"
+#include "solas/touch_event.h"
+
+namespace solas {
+
+// Writes events into shared memory that a shared input source of another
+// process has created. Only a single writer may open the same memory at a
+// time. Writing never blocks, and returns false to drop the event when the
+// reader has fallen behind by the capacity of the ring.
+class SharedInputWriter final {
+ public:
+  SharedInputWriter();
+
+  // Disallow copy semantics
+  SharedInputWriter(const SharedInputWriter&) = delete;
+  SharedInputWriter& operator=(const SharedInputWriter&) = delete;
+
+  // Opening the ring
+  bool open(const std::string& name);
+  void close();
+  bool is_open() const { return header_; }
+
+  // Writing events
+  bool write(const MouseEvent& event);
+  bool write(const KeyEvent& event);
+  bool write(const TouchEvent& event);
+  bool write(const GestureEvent& event);
+  bool write(const MotionEvent& event);
+
+  // Properties
+  std::size_t capacity() const;
+  std::uint64_t dropped() const;
+
+ private:
+  template <class Event>
+  bool encode(const Event& event);
+
+  // Managing the ring
+  bool reserve(std::size_t count);
+  SharedInputRecord& record(std::size_t index);
+  void publish(std::size_t count);
+
+ private:
+  SharedMemory memory_;
+  SharedInputHeader *header_;
+  std::uint64_t tail_;
+  std::uint64_t head_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_SHARED_INPUT_WRITER_H_
@@ -0,0 +1,116 @@
+//
+//  solas/shared_memory.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "solas/shared_memory.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <string>
+
+namespace solas {
+
+SharedMemory::SharedMemory() : data_(), size_(), owner_() {}
+
+SharedMemory::~SharedMemory() {
+  close();
+}
+
+#pragma mark Mapping
+
+bool SharedMemory::create(const std::string& name, std::size_t size) {
+  close();
+  const auto descriptor = shm_open(name.c_str(),
+                                   O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (descriptor < 0) {
+    return false;
+  }
+  if (ftruncate(descriptor, size) < 0) {
+    ::close(descriptor);
+    shm_unlink(name.c_str());
+    return false;
+  }
+  const auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                         descriptor, 0);
+  ::close(descriptor);
+  if (data == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return false;
+  }
+  name_ = name;
+  data_ = data;
+  size_ = size;
+  owner_ = true;
+  return true;
+}
+
+bool SharedMemory::open(const std::string& name) {
+  close();
+  const auto descriptor = shm_open(name.c_str(), O_RDWR, 0600);
+  if (descriptor < 0) {
+    return false;
+  }
+  struct stat status;
+  if (fstat(descriptor, &status) < 0 || status.st_size <= 0) {
+    ::close(descriptor);
+    return false;
+  }
+  const auto size = static_cast<std::size_t>(status.st_size);
+  const auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                         descriptor, 0);
+  ::close(descriptor);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  name_ = name;
+  data_ = data;
+  size_ = size;
+  owner_ = false;
+  return true;
+}
+
+void SharedMemory::close() {
+  if (!data_) {
+    return;
+  }
+  munmap(data_, size_);
+  if (owner_) {
+    shm_unlink(name_.c_str());
+  }
+  name_.clear();
+  data_ = nullptr;
+  size_ = 0;
+  owner_ = false;
+}
+
+bool SharedMemory::remove(const std::string& name) {
+  return !shm_unlink(name.c_str());
+}
+
+}  // namespace solas
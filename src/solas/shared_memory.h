@@ -0,0 +1,71 @@
+//
+//  solas/shared_memory.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_SHARED_MEMORY_H_
+#define SOLAS_SHARED_MEMORY_H_
+
+#include <cstddef>
+#include <string>
+
+namespace solas {
+
+// Named POSIX shared memory mapped into this process. The instance that
+// creates the memory also removes the name when it closes. Creating fails
+// when the name already exists, because it may belong to another process;
+// remove the name first to replace memory that a crashed process left.
+class SharedMemory final {
+ public:
+  SharedMemory();
+  ~SharedMemory();
+
+  // Disallow copy semantics
+  SharedMemory(const SharedMemory&) = delete;
+  SharedMemory& operator=(const SharedMemory&) = delete;
+
+  // Mapping
+  bool create(const std::string& name, std::size_t size);
+  bool open(const std::string& name);
+  void close();
+  bool is_open() const { return data_; }
+  static bool remove(const std::string& name);
+
+  // Properties
+  const std::string& name() const { return name_; }
+  void * data() const { return data_; }
+  std::size_t size() const { return size_; }
+  bool owner() const { return owner_; }
+
+ private:
+  std::string name_;
+  void *data_;
+  std::size_t size_;
+  bool owner_;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_SHARED_MEMORY_H_
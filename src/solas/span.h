@@ -0,0 +1,113 @@
+//
+//  solas/span.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_SPAN_H_
+#define SOLAS_SPAN_H_
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace solas {
+
+template <class T>
+class Span final {
+ public:
+  using value_type = typename std::remove_cv<T>::type;
+  using size_type = std::size_t;
+  using reference = T&;
+  using pointer = T *;
+  using iterator = T *;
+
+ public:
+  Span();
+  Span(T *data, std::size_t size);
+  template <class Container, class = typename std::enable_if<
+      !std::is_same<typename std::remove_cv<Container>::type,
+                    Span>::value>::type>
+  Span(Container& container);
+
+  // Copy semantics
+  Span(const Span&) = default;
+  Span& operator=(const Span&) = default;
+
+  // Element access
+  T& operator[](std::size_t index) const;
+  T& front() const;
+  T& back() const;
+  T * data() const { return data_; }
+
+  // Iterators
+  iterator begin() const { return data_; }
+  iterator end() const { return data_ + size_; }
+
+  // Capacity
+  std::size_t size() const { return size_; }
+  bool empty() const { return !size_; }
+
+ private:
+  T *data_;
+  std::size_t size_;
+};
+
+#pragma mark -
+
+template <class T>
+inline Span<T>::Span() : data_(), size_() {}
+
+template <class T>
+inline Span<T>::Span(T *data, std::size_t size) : data_(data), size_(size) {}
+
+template <class T>
+template <class Container, class>
+inline Span<T>::Span(Container& container)
+    : data_(container.data()),
+      size_(container.size()) {}
+
+#pragma mark Element access
+
+template <class T>
+inline T& Span<T>::operator[](std::size_t index) const {
+  assert(index < size_);
+  return data_[index];
+}
+
+template <class T>
+inline T& Span<T>::front() const {
+  assert(!empty());
+  return *data_;
+}
+
+template <class T>
+inline T& Span<T>::back() const {
+  assert(!empty());
+  return data_[size_ - 1];
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_SPAN_H_
@@ -0,0 +1,281 @@
+//
+//  solas/static_view.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_STATIC_VIEW_H_
+#define SOLAS_STATIC_VIEW_H_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "solas/app_event.h"
+#include "solas/event_holder.h"
+#include "solas/event_hook.h"
+#include "solas/gesture_event.h"
+#include "solas/key_event.h"
+#include "solas/motion_event.h"
+#include "solas/mouse_event.h"
+#include "solas/span.h"
+#include "solas/touch_event.h"
+#include "solas/view.h"
+
+// Declares the detection of a handler named "name" taking "Event", and a
+// function that returns its hook, or null when Derived defines neither of its
+// overloads.
+#define SOLAS_STATIC_VIEW_HOOK(Event, name) \
+    template <class T, class... Args> \
+    static auto name##Owner(int) \
+        -> decltype(HookOwner<Args...>::of(&T::name)); \
+    template <class T, class... Args> \
+    static View * name##Owner(...); \
+    static Hook<Event> name##Hook() { \
+      constexpr bool with_event = !std::is_same< \
+          decltype(name##Owner<Derived, const Event&>(0)), View *>::value; \
+      constexpr bool without_event = !std::is_same< \
+          decltype(name##Owner<Derived>(0)), View *>::value; \
+      if (!with_event && !without_event) { \
+        return nullptr; \
+      } \
+      return [](View& view, const Event& event) { \
+        auto& derived = static_cast<Derived&>(view); \
+        invokeIf<with_event>(derived, [&event](auto& target) { \
+          target.Derived::name(event); \
+        }); \
+        invokeIf<without_event>(derived, [](auto& target) { \
+          target.Derived::name(); \
+        }); \
+      }; \
+    }
+
+// Declares the detection of a batch handler named "name" taking a span of
+// "Event", and a function that returns its hook, or null when Derived doesn't
+// define it.
+#define SOLAS_STATIC_VIEW_BATCH_HOOK(Event, name) \
+    template <class T> \
+    static auto name##Owner(int) \
+        -> decltype(HookOwner<Span<const Event>>::of(&T::name)); \
+    template <class T> \
+    static View * name##Owner(...); \
+    static BatchHook<Event> name##Hook() { \
+      constexpr bool defined = !std::is_same< \
+          decltype(name##Owner<Derived>(0)), View *>::value; \
+      if (!defined) { \
+        return nullptr; \
+      } \
+      return [](View& view, Span<const Event> events) { \
+        auto& derived = static_cast<Derived&>(view); \
+        invokeIf<defined>(derived, [events](auto& target) { \
+          target.Derived::name(events); \
+        }); \
+      }; \
+    }
+
+namespace solas {
+
+// A view that finds the handlers Derived defines at compile time, and
+// dispatches the lifecycle and events only to them with non-virtual calls.
+// It behaves the same as View otherwise, except that it observes only the
+// types of event that it handles or that are connected to, once it handles
+// any of them. The handlers must be public, or Derived must befriend
+// StaticView<Derived>; otherwise they aren't detected.
+template <class Derived>
+class StaticView : public View {
+ public:
+  StaticView();
+  virtual ~StaticView() = 0;
+
+  // Disallow copy semantics
+  StaticView(const StaticView&) = delete;
+  StaticView& operator=(const StaticView&) = delete;
+
+  // Move semantics
+  StaticView(StaticView&&) = default;
+  StaticView& operator=(StaticView&&) = default;
+
+ private:
+  template <class Event>
+  using Hook = void (*)(View&, const Event&);
+  template <class Event>
+  using BatchHook = void (*)(View&, Span<const Event>);
+
+  template <class... Args>
+  struct HookOwner {
+    template <class Class>
+    static Class * of(void (Class::*)(Args...));
+  };
+
+  template <bool Enabled, class Function>
+  static std::enable_if_t<Enabled> invokeIf(Derived& derived,
+                                            const Function& function);
+  template <bool Enabled, class Function>
+  static std::enable_if_t<!Enabled> invokeIf(Derived& derived,
+                                             const Function& function);
+
+  // Hooks
+  static const Hooks& staticHooks();
+  template <class Event, typename Event::Type Last>
+  void observeHooks(const EventHookTable<View, Event, Last>& table);
+
+  // Lifecycle
+  SOLAS_STATIC_VIEW_HOOK(AppEvent, setup)
+  SOLAS_STATIC_VIEW_HOOK(AppEvent, update)
+  SOLAS_STATIC_VIEW_HOOK(AppEvent, pre)
+  SOLAS_STATIC_VIEW_HOOK(AppEvent, draw)
+  SOLAS_STATIC_VIEW_HOOK(AppEvent, post)
+  SOLAS_STATIC_VIEW_HOOK(AppEvent, exit)
+
+  // Events
+  SOLAS_STATIC_VIEW_HOOK(MouseEvent, mousePressed)
+  SOLAS_STATIC_VIEW_HOOK(MouseEvent, mouseDragged)
+  SOLAS_STATIC_VIEW_HOOK(MouseEvent, mouseReleased)
+  SOLAS_STATIC_VIEW_HOOK(MouseEvent, mouseMoved)
+  SOLAS_STATIC_VIEW_HOOK(MouseEvent, mouseEntered)
+  SOLAS_STATIC_VIEW_HOOK(MouseEvent, mouseExited)
+  SOLAS_STATIC_VIEW_HOOK(MouseEvent, mouseWheel)
+  SOLAS_STATIC_VIEW_HOOK(KeyEvent, keyPressed)
+  SOLAS_STATIC_VIEW_HOOK(KeyEvent, keyReleased)
+  SOLAS_STATIC_VIEW_HOOK(TouchEvent, touchesBegan)
+  SOLAS_STATIC_VIEW_HOOK(TouchEvent, touchesMoved)
+  SOLAS_STATIC_VIEW_HOOK(TouchEvent, touchesCancelled)
+  SOLAS_STATIC_VIEW_HOOK(TouchEvent, touchesEnded)
+  SOLAS_STATIC_VIEW_HOOK(GestureEvent, gestureBegan)
+  SOLAS_STATIC_VIEW_HOOK(GestureEvent, gestureChanged)
+  SOLAS_STATIC_VIEW_HOOK(GestureEvent, gestureCancelled)
+  SOLAS_STATIC_VIEW_HOOK(GestureEvent, gestureEnded)
+  SOLAS_STATIC_VIEW_HOOK(MotionEvent, motionBegan)
+  SOLAS_STATIC_VIEW_HOOK(MotionEvent, motionCancelled)
+  SOLAS_STATIC_VIEW_HOOK(MotionEvent, motionEnded)
+
+  // Event batches
+  SOLAS_STATIC_VIEW_BATCH_HOOK(MouseEvent, mouseEvents)
+  SOLAS_STATIC_VIEW_BATCH_HOOK(KeyEvent, keyEvents)
+  SOLAS_STATIC_VIEW_BATCH_HOOK(TouchEvent, touchEvents)
+  SOLAS_STATIC_VIEW_BATCH_HOOK(GestureEvent, gestureEvents)
+  SOLAS_STATIC_VIEW_BATCH_HOOK(MotionEvent, motionEvents)
+};
+
+#pragma mark -
+
+template <class Derived>
+inline StaticView<Derived>::StaticView() : View(staticHooks()) {
+  const auto& hooks = staticHooks();
+  observeHooks(hooks.mouse);
+  observeHooks(hooks.key);
+  observeHooks(hooks.touch);
+  observeHooks(hooks.gesture);
+  observeHooks(hooks.motion);
+  if (hooks.mouse_batch) {
+    batch(EventHolder::Type::MOUSE);
+  }
+  if (hooks.key_batch) {
+    batch(EventHolder::Type::KEY);
+  }
+  if (hooks.touch_batch) {
+    batch(EventHolder::Type::TOUCH);
+  }
+  if (hooks.gesture_batch) {
+    batch(EventHolder::Type::GESTURE);
+  }
+  if (hooks.motion_batch) {
+    batch(EventHolder::Type::MOTION);
+  }
+}
+
+template <class Derived>
+inline StaticView<Derived>::~StaticView() {}
+
+template <class Derived>
+template <bool Enabled, class Function>
+inline std::enable_if_t<Enabled> StaticView<Derived>::invokeIf(
+    Derived& derived, const Function& function) {
+  function(derived);
+}
+
+template <class Derived>
+template <bool Enabled, class Function>
+inline std::enable_if_t<!Enabled> StaticView<Derived>::invokeIf(
+    Derived& derived, const Function& function) {}
+
+#pragma mark Hooks
+
+template <class Derived>
+inline const View::Hooks& StaticView<Derived>::staticHooks() {
+  static const Hooks hooks = [] {
+    Hooks hooks;
+    hooks.app[AppEvent::Type::SETUP] = setupHook();
+    hooks.app[AppEvent::Type::UPDATE] = updateHook();
+    hooks.app[AppEvent::Type::PRE] = preHook();
+    hooks.app[AppEvent::Type::DRAW] = drawHook();
+    hooks.app[AppEvent::Type::POST] = postHook();
+    hooks.app[AppEvent::Type::EXIT] = exitHook();
+    hooks.mouse[MouseEvent::Type::PRESSED] = mousePressedHook();
+    hooks.mouse[MouseEvent::Type::DRAGGED] = mouseDraggedHook();
+    hooks.mouse[MouseEvent::Type::RELEASED] = mouseReleasedHook();
+    hooks.mouse[MouseEvent::Type::MOVED] = mouseMovedHook();
+    hooks.mouse[MouseEvent::Type::ENTERED] = mouseEnteredHook();
+    hooks.mouse[MouseEvent::Type::EXITED] = mouseExitedHook();
+    hooks.mouse[MouseEvent::Type::WHEEL] = mouseWheelHook();
+    hooks.key[KeyEvent::Type::PRESSED] = keyPressedHook();
+    hooks.key[KeyEvent::Type::RELEASED] = keyReleasedHook();
+    hooks.touch[TouchEvent::Type::BEGAN] = touchesBeganHook();
+    hooks.touch[TouchEvent::Type::MOVED] = touchesMovedHook();
+    hooks.touch[TouchEvent::Type::CANCELLED] = touchesCancelledHook();
+    hooks.touch[TouchEvent::Type::ENDED] = touchesEndedHook();
+    hooks.gesture[GestureEvent::Type::BEGAN] = gestureBeganHook();
+    hooks.gesture[GestureEvent::Type::CHANGED] = gestureChangedHook();
+    hooks.gesture[GestureEvent::Type::CANCELLED] = gestureCancelledHook();
+    hooks.gesture[GestureEvent::Type::ENDED] = gestureEndedHook();
+    hooks.motion[MotionEvent::Type::BEGAN] = motionBeganHook();
+    hooks.motion[MotionEvent::Type::CANCELLED] = motionCancelledHook();
+    hooks.motion[MotionEvent::Type::ENDED] = motionEndedHook();
+    hooks.mouse_batch = mouseEventsHook();
+    hooks.key_batch = keyEventsHook();
+    hooks.touch_batch = touchEventsHook();
+    hooks.gesture_batch = gestureEventsHook();
+    hooks.motion_batch = motionEventsHook();
+    return hooks;
+  }();
+  return hooks;
+}
+
+template <class Derived>
+template <class Event, typename Event::Type Last>
+inline void StaticView<Derived>::observeHooks(
+    const EventHookTable<View, Event, Last>& table) {
+  for (std::size_t i = 0; i <= static_cast<std::size_t>(Last); ++i) {
+    const auto type = static_cast<typename Event::Type>(i);
+    if (table[type]) {
+      observe(type);
+    }
+  }
+}
+
+}  // namespace solas
+
+#undef SOLAS_STATIC_VIEW_HOOK
+#undef SOLAS_STATIC_VIEW_BATCH_HOOK
+
+#endif  // SOLAS_STATIC_VIEW_H_
@@ -28,8 +28,13 @@
 #ifndef SOLAS_TOUCH_EVENT_H_
 #define SOLAS_TOUCH_EVENT_H_
 
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
+#include "solas/span.h"
 #include "takram/math.h"
 
 namespace solas {
@@ -44,18 +49,45 @@ class TouchEvent final {
     ENDED
   };
 
+  using Clock = std::chrono::steady_clock;
+
+  // Identity and phase of a touch given by the source, in the same order as
+  // the touch locations
+  struct Contact {
+    std::uintptr_t identifier;
+    Type phase;
+  };
+
  public:
   TouchEvent();
-  TouchEvent(Type type, const std::vector<takram::Vec2d>& touches);
+  TouchEvent(Type type, std::vector<takram::Vec2d> touches);
+  TouchEvent(Type type,
+             std::vector<takram::Vec2d> touches,
+             std::vector<Contact> contacts);
 
   // Copy semantics excluding assignment
-  TouchEvent(const TouchEvent&) = default;
+  TouchEvent(const TouchEvent& other);
   TouchEvent& operator=(const TouchEvent&) = delete;
 
+  // Move semantics excluding assignment
+  TouchEvent(TouchEvent&& other);
+  TouchEvent& operator=(TouchEvent&&) = delete;
+
   // Properties
   bool empty() const { return type_ == Type::UNDEFINED; }
   Type type() const { return type_; }
+  Clock::time_point timestamp() const { return timestamp_; }
+  void set_timestamp(Clock::time_point value) { timestamp_ = value; }
   const std::vector<takram::Vec2d>& touches() const { return touches_; }
+  const std::vector<Contact>& contacts() const { return contacts_; }
+
+  // Coalescing
+  Span<const TouchEvent> coalesced() const;
+  void set_coalesced(Span<const TouchEvent> value) { coalesced_ = value; }
+
+  // Releasing the payload
+  std::vector<takram::Vec2d> releaseTouches() { return std::move(touches_); }
+  std::vector<Contact> releaseContacts() { return std::move(contacts_); }
 
   // Conversion
   operator bool() const { return !empty(); }
@@ -63,16 +95,54 @@ class TouchEvent final {
  private:
   Type type_;
   std::vector<takram::Vec2d> touches_;
+  std::vector<Contact> contacts_;
+  Span<const TouchEvent> coalesced_;
+  Clock::time_point timestamp_;
 };
 
 #pragma mark -
 
 inline TouchEvent::TouchEvent() : type_(Type::UNDEFINED) {}
 
+inline TouchEvent::TouchEvent(Type type, std::vector<takram::Vec2d> touches)
+    : type_(type),
+      touches_(std::move(touches)),
+      timestamp_(Clock::now()) {}
+
 inline TouchEvent::TouchEvent(Type type,
-                              const std::vector<takram::Vec2d>& touches)
+                              std::vector<takram::Vec2d> touches,
+                              std::vector<Contact> contacts)
     : type_(type),
-      touches_(touches) {}
+      touches_(std::move(touches)),
+      contacts_(std::move(contacts)),
+      timestamp_(Clock::now()) {
+  assert(contacts_.empty() || contacts_.size() == touches_.size());
+}
+
+inline TouchEvent::TouchEvent(const TouchEvent& other)
+    : type_(other.type_),
+      touches_(other.touches_),
+      contacts_(other.contacts_),
+      timestamp_(other.timestamp_) {
+  // The coalesced samples only live until the handler of the event returns,
+  // so a copy is no more than the latest of them.
+}
+
+inline TouchEvent::TouchEvent(TouchEvent&& other)
+    : type_(other.type_),
+      touches_(std::move(other.touches_)),
+      contacts_(std::move(other.contacts_)),
+      timestamp_(other.timestamp_) {}
+
+#pragma mark Coalescing
+
+inline Span<const TouchEvent> TouchEvent::coalesced() const {
+  // Every event is a coalesced sample of itself unless it was merged
+  if (coalesced_.empty()) {
+    return Span<const TouchEvent>(this, 1);
+  }
+  return coalesced_;
+}
 
 }  // namespace solas
 
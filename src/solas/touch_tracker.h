@@ -0,0 +1,370 @@
+//
+//  solas/touch_tracker.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_TOUCH_TRACKER_H_
+#define SOLAS_TOUCH_TRACKER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "solas/span.h"
+#include "solas/touch_event.h"
+#include "takram/math.h"
+
+namespace solas {
+
+// Follows individual touches across touch events, and gives each of them an
+// identifier that stays the same while it is down. Touches are kept in
+// parallel arrays in the order they began, and those that ended stay until
+// the next advance so that their last state can be read in the same frame.
+// Events without contacts are taken as listing their touches in the same
+// order every time.
+class TouchTracker final {
+ public:
+  using Clock = TouchEvent::Clock;
+  using Identifier = std::uint32_t;
+
+  static constexpr std::size_t default_capacity = 256;
+
+ public:
+  explicit TouchTracker(std::size_t capacity = default_capacity);
+
+  // Copy semantics
+  TouchTracker(const TouchTracker&) = default;
+  TouchTracker& operator=(const TouchTracker&) = default;
+
+  // Properties
+  std::size_t capacity() const { return capacity_; }
+  std::size_t size() const { return identifiers_.size(); }
+  bool empty() const { return identifiers_.empty(); }
+
+  // Touches
+  Span<const Identifier> identifiers() const { return identifiers_; }
+  Span<const takram::Vec2d> positions() const { return positions_; }
+  Span<const takram::Vec2d> velocities() const { return velocities_; }
+  Span<const TouchEvent::Type> phases() const { return phases_; }
+  Span<const Clock::time_point> timestamps() const { return timestamps_; }
+  Span<const Clock::time_point> down_timestamps() const {
+    return down_timestamps_;
+  }
+
+  // Changes since the last advance
+  Span<const Identifier> down() const { return down_; }
+  Span<const Identifier> up() const { return up_; }
+
+  // Lookup
+  std::size_t find(Identifier identifier) const;
+  bool contains(Identifier identifier) const;
+  takram::Vec2d position(Identifier identifier) const;
+  takram::Vec2d velocity(Identifier identifier) const;
+
+  // Updating
+  void update(const TouchEvent& event);
+  void advance();
+  void reset();
+
+ private:
+  // Open addressing table from keys to indices of the touch arrays, which
+  // never allocates once constructed
+  class Table final {
+   public:
+    static constexpr std::uint32_t none =
+        std::numeric_limits<std::uint32_t>::max();
+
+   public:
+    explicit Table(std::size_t capacity);
+
+    std::uint32_t find(std::uintptr_t key) const;
+    void assign(std::uintptr_t key, std::uint32_t index);
+    void erase(std::uintptr_t key);
+    void clear();
+
+   private:
+    std::size_t bucket(std::uintptr_t key) const;
+
+   private:
+    std::vector<std::uintptr_t> keys_;
+    std::vector<std::uint32_t> indices_;
+    std::size_t mask_;
+  };
+
+  void update(std::uintptr_t source,
+              TouchEvent::Type phase,
+              const takram::Vec2d& position,
+              Clock::time_point timestamp);
+  void begin(std::uintptr_t source,
+             const takram::Vec2d& position,
+             Clock::time_point timestamp);
+
+ private:
+  std::size_t capacity_;
+  Identifier next_identifier_;
+  Table sources_table_;
+  Table identifiers_table_;
+
+  // Touches
+  std::vector<Identifier> identifiers_;
+  std::vector<std::uintptr_t> sources_;
+  std::vector<takram::Vec2d> positions_;
+  std::vector<takram::Vec2d> velocities_;
+  std::vector<TouchEvent::Type> phases_;
+  std::vector<Clock::time_point> timestamps_;
+  std::vector<Clock::time_point> down_timestamps_;
+
+  // Changes
+  std::vector<Identifier> down_;
+  std::vector<Identifier> up_;
+};
+
+#pragma mark -
+
+inline TouchTracker::TouchTracker(std::size_t capacity)
+    : capacity_(capacity),
+      next_identifier_(),
+      sources_table_(capacity),
+      identifiers_table_(capacity) {
+  identifiers_.reserve(capacity);
+  sources_.reserve(capacity);
+  positions_.reserve(capacity);
+  velocities_.reserve(capacity);
+  phases_.reserve(capacity);
+  timestamps_.reserve(capacity);
+  down_timestamps_.reserve(capacity);
+  down_.reserve(capacity);
+  up_.reserve(capacity);
+}
+
+#pragma mark Lookup
+
+inline std::size_t TouchTracker::find(Identifier identifier) const {
+  const auto index = identifiers_table_.find(identifier);
+  return index == Table::none ? size() : index;
+}
+
+inline bool TouchTracker::contains(Identifier identifier) const {
+  return identifiers_table_.find(identifier) != Table::none;
+}
+
+inline takram::Vec2d TouchTracker::position(Identifier identifier) const {
+  const auto index = find(identifier);
+  return index < size() ? positions_[index] : takram::Vec2d();
+}
+
+inline takram::Vec2d TouchTracker::velocity(Identifier identifier) const {
+  const auto index = find(identifier);
+  return index < size() ? velocities_[index] : takram::Vec2d();
+}
+
+#pragma mark Updating
+
+inline void TouchTracker::update(const TouchEvent& event) {
+  const auto& touches = event.touches();
+  const auto& contacts = event.contacts();
+  for (std::size_t i = 0; i < touches.size(); ++i) {
+    if (contacts.empty()) {
+      update(i, event.type(), touches[i], event.timestamp());
+    } else {
+      update(contacts[i].identifier, contacts[i].phase, touches[i],
+             event.timestamp());
+    }
+  }
+}
+
+inline void TouchTracker::update(std::uintptr_t source,
+                                 TouchEvent::Type phase,
+                                 const takram::Vec2d& position,
+                                 Clock::time_point timestamp) {
+  const auto index = sources_table_.find(source);
+  if (index == Table::none) {
+    if (phase == TouchEvent::Type::BEGAN || phase == TouchEvent::Type::MOVED) {
+      begin(source, position, timestamp);
+    }
+    return;
+  }
+  const auto interval = timestamp - timestamps_[index];
+  if (interval > Clock::duration::zero()) {
+    const auto seconds = std::chrono::duration<double>(interval).count();
+    const auto& previous = positions_[index];
+    auto& velocity = velocities_[index];
+
+    // Smooth the velocity over the latest samples, because the intervals of
+    // touch samples jitter.
+    velocity = takram::Vec2d(
+        (velocity.x + (position.x - previous.x) / seconds) / 2.0,
+        (velocity.y + (position.y - previous.y) / seconds) / 2.0);
+  }
+  positions_[index] = position;
+  timestamps_[index] = timestamp;
+  if (phase == TouchEvent::Type::ENDED ||
+      phase == TouchEvent::Type::CANCELLED) {
+    phases_[index] = phase;
+    up_.emplace_back(identifiers_[index]);
+    sources_table_.erase(source);
+  }
+}
+
+inline void TouchTracker::begin(std::uintptr_t source,
+                                const takram::Vec2d& position,
+                                Clock::time_point timestamp) {
+  if (size() == capacity_) {
+    return;
+  }
+  const auto identifier = next_identifier_++;
+  const auto index = static_cast<std::uint32_t>(size());
+  sources_table_.assign(source, index);
+  identifiers_table_.assign(identifier, index);
+  identifiers_.emplace_back(identifier);
+  sources_.emplace_back(source);
+  positions_.emplace_back(position);
+  velocities_.emplace_back();
+  phases_.emplace_back(TouchEvent::Type::BEGAN);
+  timestamps_.emplace_back(timestamp);
+  down_timestamps_.emplace_back(timestamp);
+  down_.emplace_back(identifier);
+}
+
+inline void TouchTracker::advance() {
+  // Remove the touches that ended, keeping the order of the others
+  std::size_t count = 0;
+  for (std::size_t index = 0; index < size(); ++index) {
+    if (phases_[index] == TouchEvent::Type::ENDED ||
+        phases_[index] == TouchEvent::Type::CANCELLED) {
+      identifiers_table_.erase(identifiers_[index]);
+      continue;
+    }
+    if (count != index) {
+      identifiers_[count] = identifiers_[index];
+      sources_[count] = sources_[index];
+      positions_[count] = positions_[index];
+      velocities_[count] = velocities_[index];
+      timestamps_[count] = timestamps_[index];
+      down_timestamps_[count] = down_timestamps_[index];
+      const auto moved = static_cast<std::uint32_t>(count);
+      identifiers_table_.assign(identifiers_[count], moved);
+      sources_table_.assign(sources_[count], moved);
+    }
+    phases_[count] = TouchEvent::Type::MOVED;
+    ++count;
+  }
+  identifiers_.resize(count);
+  sources_.resize(count);
+  positions_.resize(count);
+  velocities_.resize(count);
+  phases_.resize(count);
+  timestamps_.resize(count);
+  down_timestamps_.resize(count);
+  down_.clear();
+  up_.clear();
+}
+
+inline void TouchTracker::reset() {
+  sources_table_.clear();
+  identifiers_table_.clear();
+  identifiers_.clear();
+  sources_.clear();
+  positions_.clear();
+  velocities_.clear();
+  phases_.clear();
+  timestamps_.clear();
+  down_timestamps_.clear();
+  down_.clear();
+  up_.clear();
+}
+
+#pragma mark Table
+
+inline TouchTracker::Table::Table(std::size_t capacity) {
+  // Keep the load factor at most a half
+  std::size_t size = 1;
+  while (size < capacity * 2) {
+    size *= 2;
+  }
+  keys_.resize(size);
+  indices_.assign(size, static_cast<std::uint32_t>(none));
+  mask_ = size - 1;
+}
+
+inline std::size_t TouchTracker::Table::bucket(std::uintptr_t key) const {
+  const auto hash = static_cast<std::uint64_t>(key) * 0x9e3779b97f4a7c15ull;
+  return static_cast<std::size_t>(hash >> 32) & mask_;
+}
+
+inline std::uint32_t TouchTracker::Table::find(std::uintptr_t key) const {
+  for (auto i = bucket(key); indices_[i] != none; i = (i + 1) & mask_) {
+    if (keys_[i] == key) {
+      return indices_[i];
+    }
+  }
+  return none;
+}
+
+inline void TouchTracker::Table::assign(std::uintptr_t key,
+                                        std::uint32_t index) {
+  auto i = bucket(key);
+  for (; indices_[i] != none; i = (i + 1) & mask_) {
+    if (keys_[i] == key) {
+      break;
+    }
+  }
+  keys_[i] = key;
+  indices_[i] = index;
+}
+
+inline void TouchTracker::Table::erase(std::uintptr_t key) {
+  auto i = bucket(key);
+  for (; indices_[i] != none; i = (i + 1) & mask_) {
+    if (keys_[i] == key) {
+      break;
+    }
+  }
+  if (indices_[i] == none) {
+    return;
+  }
+  // Shift the following entries back into the hole, so that lookups never
+  // stop short of them.
+  indices_[i] = none;
+  for (auto j = (i + 1) & mask_; indices_[j] != none; j = (j + 1) & mask_) {
+    const auto k = bucket(keys_[j]);
+    if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+      keys_[i] = keys_[j];
+      indices_[i] = indices_[j];
+      indices_[j] = none;
+      i = j;
+    }
+  }
+}
+
+inline void TouchTracker::Table::clear() {
+  indices_.assign(indices_.size(), static_cast<std::uint32_t>(none));
+}
+
+}  // namespace solas
+
+#endif  // SOLAS_TOUCH_TRACKER_H_
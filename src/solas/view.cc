@@ -26,12 +26,20 @@
 
 #include "solas/view.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <utility>
+
+#include <boost/optional.hpp>
 
 #include "solas/app_event.h"
+#include "solas/event_holder.h"
 #include "solas/gesture_event.h"
 #include "solas/motion_event.h"
 #include "solas/mouse_event.h"
+#include "solas/payload_pool.h"
+#include "solas/pending_input.h"
 #include "solas/runner.h"
 #include "solas/touch_event.h"
 
@@ -40,42 +48,44 @@ namespace solas {
 #pragma mark Lifecycle
 
 void View::setup(const AppEvent& event, const Runner& runner) {
-  size_ = event.size();
-  scale_ = event.scale();
-  setup(event);
-  setup();
+  view_state_->size = event.size();
+  view_state_->scale = event.scale();
+  hooks_->app(AppEvent::Type::SETUP, *this, event);
   app_event_signals_[AppEvent::Type::SETUP](event);
 }
 
 void View::update(const AppEvent& event, const Runner& runner) {
-  update(event);
-  update();
+  hooks_->app(AppEvent::Type::UPDATE, *this, event);
   app_event_signals_[AppEvent::Type::UPDATE](event);
 }
 
 void View::pre(const AppEvent& event, const Runner& runner) {
+  touch_tracker_.advance();
   dequeueEvents();
-  size_ = event.size();
-  scale_ = event.scale();
-  pmouse_ = dmouse_;
-  ptouch_ = dtouch_;
-  pre(event);
-  pre();
+  applyPendingInput();
+  handleEventBatch();
+  resampleInput();
+  filterMotion();
+  view_state_->size = event.size();
+  view_state_->scale = event.scale();
+  view_state_->pmouse = dmouse_;
+  view_state_->ptouch = dtouch_;
+  publishFrameState();
+  hooks_->app(AppEvent::Type::PRE, *this, event);
   app_event_signals_[AppEvent::Type::PRE](event);
 }
 
 void View::draw(const AppEvent& event, const Runner& runner) {
-  draw(event);
-  draw();
+  hooks_->app(AppEvent::Type::DRAW, *this, event);
   app_event_signals_[AppEvent::Type::DRAW](event);
 }
 
 void View::post(const AppEvent& event, const Runner& runner) {
-  post(event);
-  post();
+  hooks_->app(AppEvent::Type::POST, *this, event);
   app_event_signals_[AppEvent::Type::POST](event);
-  dmouse_ = mouse_;
-  dtouch_ = touch_;
+  tracePresentation();
+  dmouse_ = view_state_->mouse;
+  dtouch_ = view_state_->touch;
   if (frame_rate_.first) {
     runner.frameRate(frame_rate_.second);
     frame_rate_.first = false;
@@ -91,201 +101,439 @@ void View::post(const AppEvent& event, const Runner& runner) {
 }
 
 void View::exit(const AppEvent& event, const Runner& runner) {
-  exit(event);
-  exit();
+  hooks_->app(AppEvent::Type::EXIT, *this, event);
   app_event_signals_[AppEvent::Type::EXIT](event);
 }
 
+#pragma mark Hooks
+
+const View::Hooks& View::virtualHooks() {
+  static const Hooks hooks = [] {
+    Hooks hooks;
+    hooks.app[AppEvent::Type::SETUP] = &invokeVirtualHooks<
+        AppEvent, &View::setup, &View::setup>;
+    hooks.app[AppEvent::Type::UPDATE] = &invokeVirtualHooks<
+        AppEvent, &View::update, &View::update>;
+    hooks.app[AppEvent::Type::PRE] = &invokeVirtualHooks<
+        AppEvent, &View::pre, &View::pre>;
+    hooks.app[AppEvent::Type::DRAW] = &invokeVirtualHooks<
+        AppEvent, &View::draw, &View::draw>;
+    hooks.app[AppEvent::Type::POST] = &invokeVirtualHooks<
+        AppEvent, &View::post, &View::post>;
+    hooks.app[AppEvent::Type::EXIT] = &invokeVirtualHooks<
+        AppEvent, &View::exit, &View::exit>;
+    hooks.mouse[MouseEvent::Type::PRESSED] = &invokeVirtualHooks<
+        MouseEvent, &View::mousePressed, &View::mousePressed>;
+    hooks.mouse[MouseEvent::Type::DRAGGED] = &invokeVirtualHooks<
+        MouseEvent, &View::mouseDragged, &View::mouseDragged>;
+    hooks.mouse[MouseEvent::Type::RELEASED] = &invokeVirtualHooks<
+        MouseEvent, &View::mouseReleased, &View::mouseReleased>;
+    hooks.mouse[MouseEvent::Type::MOVED] = &invokeVirtualHooks<
+        MouseEvent, &View::mouseMoved, &View::mouseMoved>;
+    hooks.mouse[MouseEvent::Type::ENTERED] = &invokeVirtualHooks<
+        MouseEvent, &View::mouseEntered, &View::mouseEntered>;
+    hooks.mouse[MouseEvent::Type::EXITED] = &invokeVirtualHooks<
+        MouseEvent, &View::mouseExited, &View::mouseExited>;
+    hooks.mouse[MouseEvent::Type::WHEEL] = &invokeVirtualHooks<
+        MouseEvent, &View::mouseWheel, &View::mouseWheel>;
+    hooks.key[KeyEvent::Type::PRESSED] = &invokeVirtualHooks<
+        KeyEvent, &View::keyPressed, &View::keyPressed>;
+    hooks.key[KeyEvent::Type::RELEASED] = &invokeVirtualHooks<
+        KeyEvent, &View::keyReleased, &View::keyReleased>;
+    hooks.touch[TouchEvent::Type::BEGAN] = &invokeVirtualHooks<
+        TouchEvent, &View::touchesBegan, &View::touchesBegan>;
+    hooks.touch[TouchEvent::Type::MOVED] = &invokeVirtualHooks<
+        TouchEvent, &View::touchesMoved, &View::touchesMoved>;
+    hooks.touch[TouchEvent::Type::CANCELLED] = &invokeVirtualHooks<
+        TouchEvent, &View::touchesCancelled, &View::touchesCancelled>;
+    hooks.touch[TouchEvent::Type::ENDED] = &invokeVirtualHooks<
+        TouchEvent, &View::touchesEnded, &View::touchesEnded>;
+    hooks.gesture[GestureEvent::Type::BEGAN] = &invokeVirtualHooks<
+        GestureEvent, &View::gestureBegan, &View::gestureBegan>;
+    hooks.gesture[GestureEvent::Type::CHANGED] = &invokeVirtualHooks<
+        GestureEvent, &View::gestureChanged, &View::gestureChanged>;
+    hooks.gesture[GestureEvent::Type::CANCELLED] = &invokeVirtualHooks<
+        GestureEvent, &View::gestureCancelled, &View::gestureCancelled>;
+    hooks.gesture[GestureEvent::Type::ENDED] = &invokeVirtualHooks<
+        GestureEvent, &View::gestureEnded, &View::gestureEnded>;
+    hooks.motion[MotionEvent::Type::BEGAN] = &invokeVirtualHooks<
+        MotionEvent, &View::motionBegan, &View::motionBegan>;
+    hooks.motion[MotionEvent::Type::CANCELLED] = &invokeVirtualHooks<
+        MotionEvent, &View::motionCancelled, &View::motionCancelled>;
+    hooks.motion[MotionEvent::Type::ENDED] = &invokeVirtualHooks<
+        MotionEvent, &View::motionEnded, &View::motionEnded>;
+    hooks.mouse_batch = &invokeVirtualBatchHook<
+        MouseEvent, &View::mouseEvents>;
+    hooks.key_batch = &invokeVirtualBatchHook<
+        KeyEvent, &View::keyEvents>;
+    hooks.touch_batch = &invokeVirtualBatchHook<
+        TouchEvent, &View::touchEvents>;
+    hooks.gesture_batch = &invokeVirtualBatchHook<
+        GestureEvent, &View::gestureEvents>;
+    hooks.motion_batch = &invokeVirtualBatchHook<
+        MotionEvent, &View::motionEvents>;
+    return hooks;
+  }();
+  return hooks;
+}
+
+#pragma mark Event observation
+
+namespace {
+
+InputResampler::Clock::time_point sampleTime(
+    InputResampler::Clock::time_point timestamp) {
+  // Events created without a timestamp are taken as sampled just now
+  if (timestamp == InputResampler::Clock::time_point()) {
+    return InputResampler::Clock::now();
+  }
+  return timestamp;
+}
+
+}  // namespace
+
+void View::applyPendingInput() {
+  // The state of unobserved events takes over that of the events dequeued in
+  // this frame only where it is newer, which keeps the order of input.
+  PendingInput::State state;
+  if (pending_input_->take(state)) {
+    if (state.mouse && state.mouse_time > handled_mouse_time_) {
+      view_state_->pmouse = emouse_;
+      view_state_->mouse = *state.mouse;
+      emouse_ = view_state_->mouse;
+      mouse_resampler_.add(sampleTime(state.mouse_time), view_state_->mouse);
+    }
+    if (state.mouse_button_time > handled_mouse_time_) {
+      if (state.mouse_button) {
+        view_state_->mouse_button = *state.mouse_button;
+      }
+      if (state.mouse_pressed) {
+        view_state_->mouse_pressed = *state.mouse_pressed;
+      }
+    }
+    if (state.key_time > handled_key_time_) {
+      if (state.key) {
+        view_state_->key = *state.key;
+      }
+      if (state.key_code) {
+        view_state_->key_code = *state.key_code;
+      }
+      if (state.key_pressed) {
+        view_state_->key_pressed = *state.key_pressed;
+      }
+    }
+  }
+  handled_mouse_time_ = MouseEvent::Clock::time_point();
+  handled_key_time_ = KeyEvent::Clock::time_point();
+}
+
 #pragma mark Event handlers
 
+namespace {
+
+bool coalescable(const EventHolder& event) {
+  switch (event.type()) {
+    case EventHolder::Type::MOUSE:
+      return (event.mouse().type() == MouseEvent::Type::MOVED ||
+              event.mouse().type() == MouseEvent::Type::DRAGGED);
+    case EventHolder::Type::TOUCH:
+      return event.touch().type() == TouchEvent::Type::MOVED;
+    default:
+      break;
+  }
+  return false;
+}
+
+bool coalescable(const EventHolder& event, const EventHolder& other) {
+  if (event.type() != other.type()) {
+    return false;
+  }
+  if (event.type() == EventHolder::Type::MOUSE) {
+    return (event.mouse().type() == other.mouse().type() &&
+            event.mouse().button() == other.mouse().button() &&
+            event.mouse().modifiers() == other.mouse().modifiers());
+  }
+  return (event.touch().touches().size() ==
+          other.touch().touches().size());
+}
+
+}  // namespace
+
+void View::dequeueCoalescedEvents() {
+  // Collect the events of this frame first. Events enqueued by the handlers
+  // are left for the next frame, as are those beyond the budget. The budget
+  // bounds the events collected here rather than the time to handle them.
+  auto drain = drainEvents();
+  boost::optional<EventHolder> event;
+  while (drain.proceeds() && event_queue_->pop(event)) {
+    frame_events_.emplace_back(std::move(*event));
+    drain.advance();
+  }
+  updateEventBacklog(drain);
+  if (event_latency_) {
+    const auto now = EventHolder::Clock::now();
+    for (const auto& event : frame_events_) {
+      traceEvent(event, now);
+    }
+  }
+  for (std::size_t first = 0; first < frame_events_.size();) {
+    if (!coalescable(frame_events_[first])) {
+      handleEvent(frame_events_[first]);
+      ++first;
+      continue;
+    }
+    // Moves and drags between two other events don't change buttons, keys or
+    // phases. Each of them merges into the next one of its kind when the two
+    // are alike, so that no sample is delivered after one that followed it.
+    // This also keeps translated touches from interleaving with the mouse
+    // drags.
+    auto last = first;
+    while (last + 1 < frame_events_.size() &&
+           coalescable(frame_events_[last + 1])) {
+      ++last;
+    }
+    for (auto i = first; i <= last; ++i) {
+      const auto& current = frame_events_[i];
+      auto merged = false;
+      for (auto j = i + 1; j <= last; ++j) {
+        if (frame_events_[j].type() == current.type()) {
+          merged = coalescable(current, frame_events_[j]);
+          break;
+        }
+      }
+      if (merged) {
+        continue;  // The next event of this kind takes over this one
+      }
+      // The samples are the events of this kind that merged into this one
+      auto begin = i;
+      for (auto j = i; j-- > first;) {
+        if (frame_events_[j].type() != current.type()) {
+          continue;
+        }
+        if (!coalescable(current, frame_events_[j])) {
+          break;
+        }
+        begin = j;
+      }
+      if (current.type() == EventHolder::Type::MOUSE) {
+        coalesced_mouse_events_.clear();
+        for (auto j = begin; j <= i; ++j) {
+          if (coalescable(current, frame_events_[j])) {
+            coalesced_mouse_events_.emplace_back(frame_events_[j].mouse());
+          }
+        }
+        auto& mouse = coalesced_mouse_events_.back();
+        if (coalesced_mouse_events_.size() > 1) {
+          mouse.set_coalesced(coalesced_mouse_events_);
+        }
+        handleMouseEvent(mouse);
+      } else {
+        // Copy the samples into pooled arrays, because the events of the
+        // frame are still compared against the following ones.
+        auto& pool = PayloadPool::shared();
+        for (auto j = begin; j <= i; ++j) {
+          if (coalescable(current, frame_events_[j])) {
+            const auto& sample = frame_events_[j].touch();
+            auto touches = pool.touches();
+            touches.assign(sample.touches().begin(), sample.touches().end());
+            auto contacts = pool.contacts();
+            contacts.assign(sample.contacts().begin(),
+                            sample.contacts().end());
+            coalesced_touch_events_.emplace_back(sample.type(),
+                                                 std::move(touches),
+                                                 std::move(contacts));
+            coalesced_touch_events_.back().set_timestamp(sample.timestamp());
+          }
+        }
+        auto& touch = coalesced_touch_events_.back();
+        if (coalesced_touch_events_.size() > 1) {
+          touch.set_coalesced(coalesced_touch_events_);
+        }
+        handleTouchEvent(touch);
+        for (auto& sample : coalesced_touch_events_) {
+          pool.recycle(sample.releaseTouches());
+          pool.recycle(sample.releaseContacts());
+        }
+        coalesced_touch_events_.clear();
+      }
+    }
+    first = last + 1;
+  }
+  for (auto& event : frame_events_) {
+    event_batch_.collect(event);
+    PayloadPool::shared().recycle(event);
+  }
+  frame_events_.clear();
+}
+
+void View::handleEventBatch() {
+  if (!event_batch_.enabled()) {
+    return;
+  }
+  if (!event_batch_.mouse().empty() && hooks_->mouse_batch) {
+    hooks_->mouse_batch(*this, event_batch_.mouse());
+  }
+  if (!event_batch_.key().empty() && hooks_->key_batch) {
+    hooks_->key_batch(*this, event_batch_.key());
+  }
+  if (!event_batch_.touch().empty() && hooks_->touch_batch) {
+    hooks_->touch_batch(*this, event_batch_.touch());
+  }
+  if (!event_batch_.gesture().empty() && hooks_->gesture_batch) {
+    hooks_->gesture_batch(*this, event_batch_.gesture());
+  }
+  if (!event_batch_.motion().empty() && hooks_->motion_batch) {
+    hooks_->motion_batch(*this, event_batch_.motion());
+  }
+  event_batch_.recycle();
+}
+
+void View::resampleInput() {
+  // Estimate the pointers at the time the frame is expected to be presented,
+  // which is ahead of now by the input prediction.
+  const auto time = InputResampler::Clock::now() + input_prediction_;
+  if (mouse_resampler_.empty()) {
+    view_state_->predicted_mouse = view_state_->mouse;
+  } else {
+    view_state_->predicted_mouse = mouse_resampler_.resample(time);
+  }
+  view_state_->mouse_velocity = mouse_resampler_.velocity(time);
+  if (touch_resampler_.empty()) {
+    view_state_->predicted_touch = view_state_->touch;
+  } else {
+    view_state_->predicted_touch = touch_resampler_.resample(time);
+  }
+  view_state_->touch_velocity = touch_resampler_.velocity(time);
+}
+
+void View::filterMotion() {
+  motion_window_.fill(*motion_ring_, [this](Span<const MotionSample> samples) {
+    motion_filter_.filter(samples);
+  });
+}
+
+void View::publishFrameState() {
+  frame_states_->publish(*view_state_, FrameState::Clock::now());
+}
+
+void View::tracePresentation() {
+  // The frame is considered presented once the view is done with it
+  if (!event_latency_ || traced_events_.empty()) {
+    return;
+  }
+  const auto now = EventHolder::Clock::now();
+  for (const auto& event : traced_events_) {
+    event_latency_->record(event.first, LatencyStage::PRESENT,
+                           now - event.second);
+  }
+  traced_events_.clear();
+}
+
 void View::handleMouseEvent(const MouseEvent& event) {
+  handled_mouse_time_ = std::max(handled_mouse_time_, event.timestamp());
   if (event.type() == MouseEvent::Type::PRESSED ||
       event.type() == MouseEvent::Type::DRAGGED ||
       event.type() == MouseEvent::Type::MOVED) {
-    pmouse_ = emouse_;
-    mouse_ = event.location();
+    view_state_->pmouse = emouse_;
+    view_state_->mouse = event.location();
+    for (const auto& sample : event.coalesced()) {
+      mouse_resampler_.add(sampleTime(sample.timestamp()),
+                           sample.location());
+    }
   }
-  mouse_button_ = event.button();
+  view_state_->mouse_button = event.button();
   switch (event.type()) {
     case MouseEvent::Type::PRESSED:
-      mouse_pressed_ = true;
+      view_state_->mouse_pressed = true;
       break;
     case MouseEvent::Type::RELEASED:
-      mouse_pressed_ = false;
+      view_state_->mouse_pressed = false;
       break;
     default:
       break;
   }
   if (event.type() == MouseEvent::Type::DRAGGED ||
       event.type() == MouseEvent::Type::MOVED) {
-    emouse_ = mouse_;
+    emouse_ = view_state_->mouse;
   }
-  switch (event.type()) {
-    case MouseEvent::Type::PRESSED:
-      mousePressed(event);
-      mousePressed();
-      mouse_event_signals_[event.type()](event);
-      break;
-    case MouseEvent::Type::DRAGGED:
-      mouseDragged(event);
-      mouseDragged();
-      mouse_event_signals_[event.type()](event);
-      break;
-    case MouseEvent::Type::RELEASED:
-      mouseReleased(event);
-      mouseReleased();
-      mouse_event_signals_[event.type()](event);
-      break;
-    case MouseEvent::Type::MOVED:
-      mouseMoved(event);
-      mouseMoved();
-      mouse_event_signals_[event.type()](event);
-      break;
-    case MouseEvent::Type::ENTERED:
-      mouseEntered(event);
-      mouseEntered();
-      mouse_event_signals_[event.type()](event);
-      break;
-    case MouseEvent::Type::EXITED:
-      mouseExited(event);
-      mouseExited();
-      mouse_event_signals_[event.type()](event);
-      break;
-    case MouseEvent::Type::WHEEL:
-      mouseWheel(event);
-      mouseWheel();
-      mouse_event_signals_[event.type()](event);
-      break;
-    default:
-      break;  // Ignore unknown types of event
+  if (event.type() != MouseEvent::Type::UNDEFINED) {
+    hooks_->mouse(*this, event);
+    mouse_event_signals_[event.type()](event);
   }
 }
 
 void View::handleKeyEvent(const KeyEvent& event) {
+  handled_key_time_ = std::max(handled_key_time_, event.timestamp());
   const auto str = event.characters().c_str();
-  key_ = str ? *str : char();
-  key_code_ = event.code();
+  view_state_->key = str ? *str : char();
+  view_state_->key_code = event.code();
   switch (event.type()) {
     case KeyEvent::Type::PRESSED:
-      key_pressed_ = true;
+      view_state_->key_pressed = true;
       break;
     case KeyEvent::Type::RELEASED:
-      key_pressed_ = false;
+      view_state_->key_pressed = false;
       break;
     default:
       break;
   }
-  switch (event.type()) {
-    case KeyEvent::Type::PRESSED:
-      keyPressed(event);
-      keyPressed();
-      key_event_signals_[event.type()](event);
-      break;
-    case KeyEvent::Type::RELEASED:
-      keyReleased(event);
-      keyReleased();
-      key_event_signals_[event.type()](event);
-      break;
-    default:
-      break;  // Ignore unknown types of event
+  if (event.type() != KeyEvent::Type::UNDEFINED) {
+    hooks_->key(*this, event);
+    key_event_signals_[event.type()](event);
   }
 }
 
 void View::handleTouchEvent(const TouchEvent& event) {
   if (event.type() == TouchEvent::Type::BEGAN) {
-    ptouch_ = etouch_;
-    touch_ = event.touches().front();
+    view_state_->ptouch = etouch_;
+    view_state_->touch = event.touches().front();
+    touch_resampler_.reset();
   } else if (event.type() == TouchEvent::Type::MOVED) {
-    ptouch_ = etouch_;
-    touch_ = event.touches().front();
+    view_state_->ptouch = etouch_;
+    view_state_->touch = event.touches().front();
+  }
+  if (event.type() == TouchEvent::Type::BEGAN ||
+      event.type() == TouchEvent::Type::MOVED) {
+    for (const auto& sample : event.coalesced()) {
+      touch_resampler_.add(sampleTime(sample.timestamp()),
+                           sample.touches().front());
+    }
+  }
+  for (const auto& sample : event.coalesced()) {
+    touch_tracker_.update(sample);
   }
   switch (event.type()) {
     case TouchEvent::Type::BEGAN:
-      touch_pressed_ = true;
+      view_state_->touch_pressed = true;
       break;
     case TouchEvent::Type::CANCELLED:
     case TouchEvent::Type::ENDED:
-      touch_pressed_ = false;
+      view_state_->touch_pressed = false;
       break;
     default:
       break;
   }
   if (event.type() == TouchEvent::Type::BEGAN ||
       event.type() == TouchEvent::Type::MOVED) {
-    etouch_ = touch_;
+    etouch_ = view_state_->touch;
   }
-  switch (event.type()) {
-    case TouchEvent::Type::BEGAN:
-      touchesBegan(event);
-      touchesBegan();
-      touch_event_signals_[event.type()](event);
-      break;
-    case TouchEvent::Type::MOVED:
-      touchesMoved(event);
-      touchesMoved();
-      touch_event_signals_[event.type()](event);
-      break;
-    case TouchEvent::Type::CANCELLED:
-      touchesCancelled(event);
-      touchesCancelled();
-      touch_event_signals_[event.type()](event);
-      break;
-    case TouchEvent::Type::ENDED:
-      touchesEnded(event);
-      touchesEnded();
-      touch_event_signals_[event.type()](event);
-      break;
-    default:
-      break;  // Ignore unknown types of event
+  if (event.type() != TouchEvent::Type::UNDEFINED) {
+    hooks_->touch(*this, event);
+    touch_event_signals_[event.type()](event);
   }
 }
 
 void View::handleGestureEvent(const GestureEvent& event) {
-  switch (event.type()) {
-    case GestureEvent::Type::BEGAN:
-      gestureBegan(event);
-      gestureBegan();
-      gesture_event_signals_[event.type()](event);
-      break;
-    case GestureEvent::Type::CHANGED:
-      gestureChanged(event);
-      gestureChanged();
-      gesture_event_signals_[event.type()](event);
-      break;
-    case GestureEvent::Type::CANCELLED:
-      gestureCancelled(event);
-      gestureCancelled();
-      gesture_event_signals_[event.type()](event);
-      break;
-    case GestureEvent::Type::ENDED:
-      gestureEnded(event);
-      gestureEnded();
-      gesture_event_signals_[event.type()](event);
-      break;
-    default:
-      break;  // Ignore unknown types of event
+  if (event.type() != GestureEvent::Type::UNDEFINED) {
+    hooks_->gesture(*this, event);
+    gesture_event_signals_[event.type()](event);
   }
 }
 
 void View::handleMotionEvent(const MotionEvent& event) {
-  switch (event.type()) {
-    case MotionEvent::Type::BEGAN:
-      motionBegan(event);
-      motionBegan();
-      motion_event_signals_[event.type()](event);
-      break;
-    case MotionEvent::Type::CANCELLED:
-      motionCancelled(event);
-      motionCancelled();
-      motion_event_signals_[event.type()](event);
-      break;
-    case MotionEvent::Type::ENDED:
-      motionEnded(event);
-      motionEnded();
-      motion_event_signals_[event.type()](event);
-      break;
-    default:
-      break;  // Ignore unknown types of event
+  if (event.type() != MotionEvent::Type::UNDEFINED) {
+    hooks_->motion(*this, event);
+    motion_event_signals_[event.type()](event);
   }
 }
 
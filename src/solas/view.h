@@ -28,25 +28,50 @@
 #ifndef SOLAS_VIEW_H_
 #define SOLAS_VIEW_H_
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <list>
-#include <queue>
-#include <unordered_map>
+#include <memory>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
-#include <boost/signals2.hpp>
+#include <boost/optional.hpp>
 
 #include "solas/app_event.h"
 #include "solas/composite.h"
+#include "solas/event_batch.h"
+#include "solas/event_drain.h"
 #include "solas/event_holder.h"
+#include "solas/event_hook.h"
+#include "solas/event_latency.h"
+#include "solas/event_mask.h"
+#include "solas/event_queue.h"
+#include "solas/event_signal.h"
+#include "solas/frame_state.h"
+#include "solas/frame_state_ring.h"
 #include "solas/gesture_event.h"
+#include "solas/input_resampler.h"
 #include "solas/key_event.h"
+#include "solas/latency_stage.h"
 #include "solas/motion_event.h"
+#include "solas/motion_filter.h"
+#include "solas/motion_ring.h"
+#include "solas/motion_sample.h"
+#include "solas/motion_window.h"
 #include "solas/mouse_button.h"
 #include "solas/mouse_event.h"
+#include "solas/payload_pool.h"
+#include "solas/pending_input.h"
 #include "solas/runnable.h"
 #include "solas/runner.h"
+#include "solas/runner_options.h"
+#include "solas/span.h"
 #include "solas/touch_event.h"
+#include "solas/touch_tracker.h"
+#include "solas/view_state.h"
 #include "takram/math.h"
 
 namespace solas {
@@ -55,14 +80,8 @@ class Runner;
 
 class View : public Runnable, public Composite {
  public:
-  using EventConnection = boost::signals2::connection;
-  using EventConnectionList = std::list<boost::signals2::scoped_connection>;
-
- private:
-  template <class Event>
-  using EventSignals = std::unordered_map<
-      typename Event::Type,
-      boost::signals2::signal<void(const Event&)>>;
+  using EventConnection = solas::EventConnection;
+  using EventConnectionList = std::list<ScopedEventConnection>;
 
  private:
   template <class Event, class Type = typename Event::Type>
@@ -74,6 +93,22 @@ class View : public Runnable, public Composite {
     static void disconnect(Type type, const Slot& slot, View *view);
   };
 
+ protected:
+  // Handlers of the lifecycle and events, which a view dispatches to
+  struct Hooks {
+    EventHookTable<View, AppEvent, AppEvent::Type::EXIT> app;
+    EventHookTable<View, MouseEvent, MouseEvent::Type::WHEEL> mouse;
+    EventHookTable<View, KeyEvent, KeyEvent::Type::RELEASED> key;
+    EventHookTable<View, TouchEvent, TouchEvent::Type::ENDED> touch;
+    EventHookTable<View, GestureEvent, GestureEvent::Type::ENDED> gesture;
+    EventHookTable<View, MotionEvent, MotionEvent::Type::ENDED> motion;
+    void (*mouse_batch)(View&, Span<const MouseEvent>) = nullptr;
+    void (*key_batch)(View&, Span<const KeyEvent>) = nullptr;
+    void (*touch_batch)(View&, Span<const TouchEvent>) = nullptr;
+    void (*gesture_batch)(View&, Span<const GestureEvent>) = nullptr;
+    void (*motion_batch)(View&, Span<const MotionEvent>) = nullptr;
+  };
+
  public:
   View();
   virtual ~View() = 0;
@@ -92,31 +127,31 @@ class View : public Runnable, public Composite {
   void resize(double width, double height) const override;
   void fullScreen(bool flag) const override;
 
-  // Structure
-  const takram::Size2d& size() const override;
-  double width() const override;
-  double height() const override;
-  double scale() const override;
-
-  // Mouse
-  const takram::Vec2d& mouse() const override;
-  const takram::Vec2d& pmouse() const override;
-  MouseButton mouse_button() const override;
-  bool mouse_pressed() const override;
-
-  // Key
-  char key() const override;
-  std::uint32_t key_code() const override;
-  bool key_pressed() const override;
-
   // Touches
-  const takram::Vec2d& touch() const override;
-  const takram::Vec2d& ptouch() const override;
-  bool touch_pressed() const override;
+  const TouchTracker& touch_tracker() const { return touch_tracker_; }
+
+  // Frame state, which is empty until the first frame
+  FrameStateRing::Reference frame_state() const;
+  const FrameStateRing& frame_states() const { return *frame_states_; }
 
   // Aggregation
   Composite * parent() const override;
 
+  // Motion
+  const MotionState& motion() const { return motion_filter_.state(); }
+  Span<const MotionSample> motion_window() const;
+  MotionFilter& motion_filter() { return motion_filter_; }
+  const MotionFilter& motion_filter() const { return motion_filter_; }
+  const MotionRing& motion_ring() const { return *motion_ring_; }
+
+  // Event queue
+  const EventQueue& event_queue() const;
+  std::size_t event_backlog() const { return event_backlog_; }
+  double event_backlog_age() const;
+
+  // Event latency
+  const EventLatency& event_latency() const;
+
   // Event connection
   template <class Event, class Slot, class Type = typename Event::Type>
   EventConnection connect(Type type, const Slot& slot);
@@ -124,6 +159,15 @@ class View : public Runnable, public Composite {
   void disconnect(Type type, const Slot& slot);
 
  protected:
+  explicit View(const Hooks& hooks);
+
+  // Event observation
+  template <class Type>
+  void observe(Type type);
+
+  // Event batching
+  void batch(EventHolder::Type type);
+
   // Lifecycle
   virtual void setup(const AppEvent& event) {}
   virtual void update(const AppEvent& event) {}
@@ -180,11 +224,53 @@ class View : public Runnable, public Composite {
   virtual void motionCancelled() {}
   virtual void motionEnded() {}
 
+  // Event batches, which receive the events of each type handled in a frame
+  // once they are enabled by batch()
+  virtual void mouseEvents(Span<const MouseEvent> events) {}
+  virtual void keyEvents(Span<const KeyEvent> events) {}
+  virtual void touchEvents(Span<const TouchEvent> events) {}
+  virtual void gestureEvents(Span<const GestureEvent> events) {}
+  virtual void motionEvents(Span<const MotionEvent> events) {}
+
  private:
+  // Configuration
+  void configure(const RunnerOptions& options) override;
+
+  // Event observation
+  bool observes(MouseEvent::Type type) const override;
+  bool observes(KeyEvent::Type type) const override;
+  bool observes(TouchEvent::Type type) const override;
+  bool observes(GestureEvent::Type type) const override;
+  bool observes(MotionEvent::Type type) const override;
+  void applyPendingInput();
+
+  // Hooks
+  static const Hooks& virtualHooks();
+  template <class Event,
+            void (View::*WithEvent)(const Event&),
+            void (View::*WithoutEvent)()>
+  static void invokeVirtualHooks(View& view, const Event& event);
+  template <class Event, void (View::*Batch)(Span<const Event>)>
+  static void invokeVirtualBatchHook(View& view, Span<const Event> events);
+
   // Event handlers
   template <class Event>
-  void enqueueEvent(const Event& event);
+  void enqueueEvent(Event&& event);
+  void recycleEvent(KeyEvent&& event);
+  void recycleEvent(GestureEvent&& event);
+  template <class Event>
+  void recycleEvent(Event&&) {}
+  EventDrain drainEvents() const;
   void dequeueEvents();
+  void dequeueCoalescedEvents();
+  void updateEventBacklog(const EventDrain& drain);
+  void handleEventBatch();
+  void resampleInput();
+  void filterMotion();
+  void publishFrameState();
+  void traceEvent(const EventHolder& event,
+                  EventHolder::Clock::time_point now);
+  void tracePresentation();
   void handleEvent(const EventHolder& event);
   void handleMouseEvent(const MouseEvent& event);
   void handleKeyEvent(const KeyEvent& event);
@@ -221,58 +307,93 @@ class View : public Runnable, public Composite {
   void motionBegan(const MotionEvent& event, const Runner&) override;
   void motionCancelled(const MotionEvent& event, const Runner&) override;
   void motionEnded(const MotionEvent& event, const Runner&) override;
+  void keyPressed(KeyEvent&& event, const Runner&) override;
+  void keyReleased(KeyEvent&& event, const Runner&) override;
+  void touchesBegan(TouchEvent&& event, const Runner&) override;
+  void touchesMoved(TouchEvent&& event, const Runner&) override;
+  void touchesCancelled(TouchEvent&& event, const Runner&) override;
+  void touchesEnded(TouchEvent&& event, const Runner&) override;
+  void gestureBegan(GestureEvent&& event, const Runner&) override;
+  void gestureChanged(GestureEvent&& event, const Runner&) override;
+  void gestureCancelled(GestureEvent&& event, const Runner&) override;
+  void gestureEnded(GestureEvent&& event, const Runner&) override;
+  void motionSampled(const MotionSample& sample, const Runner&) override;
 
  private:
-  std::queue<EventHolder> event_queue_;
+  const Hooks *hooks_;
+  std::unique_ptr<EventQueue> event_queue_;
+  bool coalesces_events_;
+  std::size_t event_drain_limit_;
+  double event_drain_duration_;
+  std::size_t event_drain_minimum_;
+  std::size_t event_backlog_;
+  EventDrain::Clock::time_point event_backlog_time_;
+  EventBatch event_batch_;
+  std::unique_ptr<EventLatency> event_latency_;
+  std::vector<std::pair<EventHolder::Type, EventHolder::Clock::time_point>>
+      traced_events_;
+  std::vector<EventHolder> frame_events_;
+  std::vector<MouseEvent> coalesced_mouse_events_;
+  std::vector<TouchEvent> coalesced_touch_events_;
+  EventMask event_mask_;
+  std::unique_ptr<PendingInput> pending_input_;
+  MouseEvent::Clock::time_point handled_mouse_time_;
+  KeyEvent::Clock::time_point handled_key_time_;
+  std::unique_ptr<MotionRing> motion_ring_;
+  MotionWindow motion_window_;
+  MotionFilter motion_filter_;
+  InputResampler::Clock::duration input_prediction_;
 
   // Environment
   mutable std::pair<bool, double> frame_rate_;
   mutable std::pair<bool, takram::Size2d> resize_;
   mutable std::pair<bool, bool> full_screen_;
 
-  // Structure
-  takram::Size2d size_;
-  double scale_;
+  // State
+  std::unique_ptr<ViewState> view_state_;
+  std::unique_ptr<FrameStateRing> frame_states_;
 
   // Mouse
-  takram::Vec2d mouse_;
-  takram::Vec2d pmouse_;
   takram::Vec2d dmouse_;
   takram::Vec2d emouse_;
-  MouseButton mouse_button_;
-  bool mouse_pressed_;
-
-  // Key
-  char key_;
-  std::uint32_t key_code_;
-  bool key_pressed_;
+  InputResampler mouse_resampler_;
 
-  // Mouse
-  takram::Vec2d touch_;
-  takram::Vec2d ptouch_;
+  // Touches
   takram::Vec2d dtouch_;
   takram::Vec2d etouch_;
-  bool touch_pressed_;
+  InputResampler touch_resampler_;
+  TouchTracker touch_tracker_;
 
   // Event signals
-  EventSignals<AppEvent> app_event_signals_;
-  EventSignals<MouseEvent> mouse_event_signals_;
-  EventSignals<KeyEvent> key_event_signals_;
-  EventSignals<TouchEvent> touch_event_signals_;
-  EventSignals<GestureEvent> gesture_event_signals_;
-  EventSignals<MotionEvent> motion_event_signals_;
+  EventSignalTable<AppEvent, AppEvent::Type::EXIT> app_event_signals_;
+  EventSignalTable<MouseEvent, MouseEvent::Type::WHEEL> mouse_event_signals_;
+  EventSignalTable<KeyEvent, KeyEvent::Type::RELEASED> key_event_signals_;
+  EventSignalTable<TouchEvent, TouchEvent::Type::ENDED> touch_event_signals_;
+  EventSignalTable<GestureEvent, GestureEvent::Type::ENDED>
+      gesture_event_signals_;
+  EventSignalTable<MotionEvent, MotionEvent::Type::ENDED>
+      motion_event_signals_;
 };
 
 #pragma mark -
 
-inline View::View()
-    : scale_(),
-      mouse_button_(MouseButton::UNDEFINED),
-      mouse_pressed_(),
-      key_(),
-      key_code_(),
-      key_pressed_(),
-      touch_pressed_() {}
+inline View::View() : View(virtualHooks()) {}
+
+inline View::View(const Hooks& hooks)
+    : hooks_(&hooks),
+      event_queue_(std::make_unique<EventQueue>()),
+      coalesces_events_(),
+      event_drain_limit_(),
+      event_drain_duration_(),
+      event_drain_minimum_(),
+      event_backlog_(),
+      pending_input_(std::make_unique<PendingInput>()),
+      motion_ring_(std::make_unique<MotionRing>()),
+      input_prediction_(),
+      view_state_(std::make_unique<ViewState>()),
+      frame_states_(std::make_unique<FrameStateRing>()) {
+  set_state(view_state_.get());
+}
 
 inline View::~View() {}
 
@@ -297,100 +418,196 @@ inline void View::fullScreen(bool flag) const {
   full_screen_.second = true;
 }
 
-#pragma mark Structure
+#pragma mark Frame state
 
-inline double View::width() const {
-  return size_.width;
+inline FrameStateRing::Reference View::frame_state() const {
+  return frame_states_->acquire();
 }
 
-inline double View::height() const {
-  return size_.height;
-}
+#pragma mark Aggregation
 
-inline double View::scale() const {
-  return scale_;
+inline Composite * View::parent() const {
+  return nullptr;
 }
 
-inline const takram::Size2d& View::size() const {
-  return size_;
+#pragma mark Motion
+
+inline Span<const MotionSample> View::motion_window() const {
+  return motion_window_.samples();
 }
 
-#pragma mark Mouse
+#pragma mark Event queue
 
-inline const takram::Vec2d& View::mouse() const {
-  return mouse_;
+inline const EventQueue& View::event_queue() const {
+  return *event_queue_;
 }
 
-inline const takram::Vec2d& View::pmouse() const {
-  return pmouse_;
+inline double View::event_backlog_age() const {
+  if (!event_backlog_) {
+    return 0.0;
+  }
+  return std::chrono::duration<double>(
+      EventDrain::Clock::now() - event_backlog_time_).count();
 }
 
-inline MouseButton View::mouse_button() const {
-  return mouse_button_;
+#pragma mark Event latency
+
+inline const EventLatency& View::event_latency() const {
+  static const EventLatency empty;
+  return event_latency_ ? *event_latency_ : empty;
 }
 
-inline bool View::mouse_pressed() const {
-  return mouse_pressed_;
+#pragma mark Event connection
+
+template <class Event, class Slot, class Type>
+inline View::EventConnection View::connect(Type type, const Slot& slot) {
+  return EventConnector<Event>::connect(type, slot, this);
 }
 
-#pragma mark Key
+template <class Event, class Slot, class Type>
+inline void View::disconnect(Type type, const Slot& slot) {
+  EventConnector<Event>::disconnect(type, slot, this);
+}
 
-inline char View::key() const {
-  return key_;
+#pragma mark Configuration
+
+inline void View::configure(const RunnerOptions& options) {
+  event_queue_ = std::make_unique<EventQueue>(options.event_queue_capacity(),
+                                              options.event_overflow());
+  coalesces_events_ = options.coalesces_events();
+  event_drain_limit_ = options.event_drain_limit();
+  event_drain_duration_ = options.event_drain_duration();
+  event_drain_minimum_ = options.event_drain_minimum();
+  if (options.traces_latency()) {
+    event_latency_ = std::make_unique<EventLatency>();
+    traced_events_.reserve(event_queue_->capacity());
+  } else {
+    event_latency_.reset();
+  }
+  input_prediction_ = std::chrono::duration_cast<
+      InputResampler::Clock::duration>(
+          std::chrono::duration<double>(options.input_prediction()));
+  mouse_resampler_.set_extrapolation_limit(options.input_extrapolation());
+  touch_resampler_.set_extrapolation_limit(options.input_extrapolation());
+  motion_ring_ = std::make_unique<MotionRing>(options.motion_capacity());
+  motion_window_ = MotionWindow(options.motion_window());
+  motion_filter_.reset();
 }
 
-inline std::uint32_t View::key_code() const {
-  return key_code_;
+#pragma mark Event observation
+
+template <class Type>
+inline void View::observe(Type type) {
+  event_mask_.set(type);
+  event_mask_.declare();
 }
 
-inline bool View::key_pressed() const {
-  return key_pressed_;
+inline bool View::observes(MouseEvent::Type type) const {
+  return event_mask_.test(type);
 }
 
-#pragma mark Touches
+inline bool View::observes(KeyEvent::Type type) const {
+  return event_mask_.test(type);
+}
 
-inline const takram::Vec2d& View::touch() const {
-  return touch_;
+inline bool View::observes(TouchEvent::Type type) const {
+  return event_mask_.test(type);
 }
 
-inline const takram::Vec2d& View::ptouch() const {
-  return ptouch_;
+inline bool View::observes(GestureEvent::Type type) const {
+  return event_mask_.test(type);
 }
 
-inline bool View::touch_pressed() const {
-  return touch_pressed_;
+inline bool View::observes(MotionEvent::Type type) const {
+  return event_mask_.test(type);
 }
 
-#pragma mark Aggregation
+#pragma mark Event batching
 
-inline Composite * View::parent() const {
-  return nullptr;
+inline void View::batch(EventHolder::Type type) {
+  // Batches must see every event of the type, but this doesn't declare the
+  // mask so that views observing everything keep doing so.
+  event_mask_.set(type);
+  event_batch_.enable(type);
 }
 
-#pragma mark Event connection
+#pragma mark Hooks
 
-template <class Event, class Slot, class Type>
-inline View::EventConnection View::connect(Type type, const Slot& slot) {
-  return EventConnector<Event>::connect(type, slot, this);
+template <class Event,
+          void (View::*WithEvent)(const Event&),
+          void (View::*WithoutEvent)()>
+inline void View::invokeVirtualHooks(View& view, const Event& event) {
+  (view.*WithEvent)(event);
+  (view.*WithoutEvent)();
 }
 
-template <class Event, class Slot, class Type>
-inline void View::disconnect(Type type, const Slot& slot) {
-  EventConnector<Event>::disconnect(type, slot, this);
+template <class Event, void (View::*Batch)(Span<const Event>)>
+inline void View::invokeVirtualBatchHook(View& view,
+                                         Span<const Event> events) {
+  (view.*Batch)(events);
 }
 
 #pragma mark Event handlers
 
 template <class Event>
-inline void View::enqueueEvent(const Event& event) {
-  event_queue_.emplace(event);
+inline void View::enqueueEvent(Event&& event) {
+  // Touches are queued even if no handler observes them, because the touch
+  // tracker has to follow every one of them.
+  if (event_mask_.test(event.type()) ||
+      std::is_same<std::decay_t<Event>, TouchEvent>::value) {
+    // The time of enqueueing is only needed for tracing latency
+    const auto enqueued = (event_latency_ ? EventHolder::Clock::now()
+                                          : EventHolder::Clock::time_point());
+    event_queue_->push(std::forward<Event>(event), enqueued);
+  } else {
+    pending_input_->merge(event);
+    recycleEvent(std::forward<Event>(event));
+  }
+}
+
+inline void View::recycleEvent(KeyEvent&& event) {
+  // Payloads of events that are handed over and never queued go back to the
+  // pool, while those of events passed by reference stay with the caller.
+  PayloadPool::shared().recycle(event.releaseCharacters());
+}
+
+inline void View::recycleEvent(GestureEvent&& event) {
+  PayloadPool::shared().recycle(event.releaseTouches());
+}
+
+inline EventDrain View::drainEvents() const {
+  // Handle at least a quarter of the events left over from the last frame,
+  // so that the backlog stops growing once it is four times the rate of input
+  // and shrinks after that.
+  return EventDrain(event_drain_limit_, event_drain_duration_,
+                    std::max(event_drain_minimum_, event_backlog_ / 4));
 }
 
 inline void View::dequeueEvents() {
-  while (!event_queue_.empty()) {
-    handleEvent(event_queue_.front());
-    event_queue_.pop();
+  if (coalesces_events_) {
+    dequeueCoalescedEvents();
+    return;
   }
+  auto drain = drainEvents();
+  boost::optional<EventHolder> event;
+  while (drain.proceeds() && event_queue_->pop(event)) {
+    if (event_latency_) {
+      traceEvent(*event, EventHolder::Clock::now());
+    }
+    handleEvent(*event);
+    event_batch_.collect(*event);
+    PayloadPool::shared().recycle(*event);
+    drain.advance();
+  }
+  updateEventBacklog(drain);
+}
+
+inline void View::updateEventBacklog(const EventDrain& drain) {
+  const auto backlog = drain.exhausted() ? event_queue_->size() : 0;
+  if (backlog && !event_backlog_) {
+    event_backlog_time_ = EventDrain::Clock::now();
+  }
+  event_backlog_ = backlog;
 }
 
 inline void View::handleEvent(const EventHolder& event) {
@@ -416,6 +633,21 @@ inline void View::handleEvent(const EventHolder& event) {
   }
 }
 
+inline void View::traceEvent(const EventHolder& event,
+                             EventHolder::Clock::time_point now) {
+  const auto timestamp = event.timestamp();
+  if (timestamp == EventHolder::Clock::time_point()) {
+    return;  // Not stamped at its source
+  }
+  if (event.enqueued() != EventHolder::Clock::time_point()) {
+    event_latency_->record(event.type(), LatencyStage::ENQUEUE,
+                           event.enqueued() - timestamp);
+  }
+  event_latency_->record(event.type(), LatencyStage::DISPATCH,
+                         now - timestamp);
+  traced_events_.emplace_back(event.type(), timestamp);
+}
+
 #pragma mark Events
 
 inline void View::mousePressed(const MouseEvent& event, const Runner&) {
@@ -498,6 +730,50 @@ inline void View::motionEnded(const MotionEvent& event, const Runner&) {
   enqueueEvent(event);
 }
 
+inline void View::keyPressed(KeyEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::keyReleased(KeyEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::touchesBegan(TouchEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::touchesMoved(TouchEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::touchesCancelled(TouchEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::touchesEnded(TouchEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::gestureBegan(GestureEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::gestureChanged(GestureEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::gestureCancelled(GestureEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::gestureEnded(GestureEvent&& event, const Runner&) {
+  enqueueEvent(std::move(event));
+}
+
+inline void View::motionSampled(const MotionSample& sample, const Runner&) {
+  motion_ring_->push(sample);
+}
+
 #pragma mark -
 
 template <>
@@ -521,6 +797,7 @@ struct View::EventConnector<MouseEvent> {
 
   template <class Slot>
   static EventConnection connect(Type type, const Slot& slot, View *view) {
+    view->event_mask_.set(type);
     return view->mouse_event_signals_[type].connect(slot);
   }
 
@@ -536,6 +813,7 @@ struct View::EventConnector<KeyEvent> {
 
   template <class Slot>
   static EventConnection connect(Type type, const Slot& slot, View *view) {
+    view->event_mask_.set(type);
     return view->key_event_signals_[type].connect(slot);
   }
 
@@ -551,6 +829,7 @@ struct View::EventConnector<TouchEvent> {
 
   template <class Slot>
   static EventConnection connect(Type type, const Slot& slot, View *view) {
+    view->event_mask_.set(type);
     return view->touch_event_signals_[type].connect(slot);
   }
 
@@ -566,6 +845,7 @@ struct View::EventConnector<GestureEvent> {
 
   template <class Slot>
   static EventConnection connect(Type type, const Slot& slot, View *view) {
+    view->event_mask_.set(type);
     return view->gesture_event_signals_[type].connect(slot);
   }
 
@@ -581,6 +861,7 @@ struct View::EventConnector<MotionEvent> {
 
   template <class Slot>
   static EventConnection connect(Type type, const Slot& slot, View *view) {
+    view->event_mask_.set(type);
     return view->motion_event_signals_[type].connect(slot);
   }
 
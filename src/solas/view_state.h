@@ -0,0 +1,74 @@
+//
+//  solas/view_state.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2015-2016 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef SOLAS_VIEW_STATE_H_
+#define SOLAS_VIEW_STATE_H_
+
+#include <cstdint>
+
+#include "solas/mouse_button.h"
+#include "takram/math.h"
+
+namespace solas {
+
+class Composite;
+
+// Structure and input of the current frame of a view, which the view updates
+// before drawing and every composite in its tree reads directly. It also
+// points back to the view, which is the root of the tree.
+struct ViewState {
+  // Tree
+  Composite *root = nullptr;
+
+  // Structure
+  takram::Size2d size;
+  double scale = 0.0;
+
+  // Mouse
+  takram::Vec2d mouse;
+  takram::Vec2d pmouse;
+  MouseButton mouse_button = MouseButton::UNDEFINED;
+  bool mouse_pressed = false;
+  takram::Vec2d predicted_mouse;
+  takram::Vec2d mouse_velocity;
+
+  // Key
+  char key = 0;
+  std::uint32_t key_code = 0;
+  bool key_pressed = false;
+
+  // Touches
+  takram::Vec2d touch;
+  takram::Vec2d ptouch;
+  bool touch_pressed = false;
+  takram::Vec2d predicted_touch;
+  takram::Vec2d touch_velocity;
+};
+
+}  // namespace solas
+
+#endif  // SOLAS_VIEW_STATE_H_